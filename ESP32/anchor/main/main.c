@@ -0,0 +1,873 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "esp_event.h"
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_wifi.h"
+#include "esp_system.h"
+#include "esp_mac.h"
+#include "esp_sntp.h"
+#include "esp_timer.h"
+#include "mqtt_client.h"
+#include "esp_wifi_types.h"
+#include "cJSON.h"
+#include "esp_now.h"
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+#include "ftm_sync.h"
+
+#define TAG "gtec-ftm-anchor"
+
+#define WIFI_SSID "Lucía"
+#define WIFI_PASS "passwordlucia"
+#define MQTT_URI         "mqtt://172.20.10.13:1884"
+#define MQTT_TOPIC       "data"
+#define MQTT_INTERVAL_MS 60000
+#define MQTT_CALIB_TOPIC "calibration/"
+#define MQTT_CONFIG_TOPIC "config/"
+#define MQTT_PLAN_TOPIC  "plan/"
+
+#define NVS_NAMESPACE       "anchor"
+#define NVS_KEY_FTM_OFFSET  "ftm_offset"
+#define NVS_KEY_ID          "id"
+#define NVS_KEY_CHANNEL     "channel"
+#define NVS_KEY_BW          "bw"
+#define NVS_KEY_POSITION    "position"
+#define NVS_KEY_GATEWAY     "gateway"
+
+#define WIFI_RETRY_MAX   -1
+
+#define SNTP_SERVER          "pool.ntp.org"
+/* Refresh period of the time sync IE; it bounds the error of a tag that only
+ * has the beacon time. The driver copies vendor IEs, so each refresh is a
+ * remove and re-add that rebuilds the beacon and probe response templates.
+ * One refresh per beacon interval (102.4 ms) keeps that off the Wi-Fi task
+ * and matches what a beacon can carry anyway. Tags on the ESP-NOW uplink
+ * correct this lag with the times in the gateway's reply to each round. */
+#define SYNC_IE_PERIOD_MS    100
+
+/* ESP-NOW gateway: round reports received within ESPNOW_BATCH_MS are
+ * forwarded to MQTT_TOPIC as a single message */
+#define ESPNOW_QUEUE_LEN    16
+#define ESPNOW_BATCH_MS     200
+#define ESPNOW_BATCH_MAX    8
+#define ESPNOW_JSON_SIZE    4096
+
+/* Ranging plans received on MQTT_PLAN_TOPIC "+", one per tag, that a gateway
+ * broadcasts back to the tag after each of its rounds */
+#define GATEWAY_MAX_PLANS   64
+
+/* Defaults used until the anchor is provisioned through MQTT_CONFIG_TOPIC */
+#define DEFAULT_ANCHOR_ID   "0"
+#define DEFAULT_CHANNEL     1
+#define DEFAULT_BW          WIFI_BW_HT20
+#define DEFAULT_POSITION_X  0.0f
+#define DEFAULT_POSITION_Y  0.0f
+#define DEFAULT_POSITION_Z  0.0f
+#define DEFAULT_GATEWAY     false
+
+typedef enum {
+    WIFI_AP_START_BIT = BIT0,
+    WIFI_STA_CONNECTED_BIT = BIT1,
+    FTM_RESPONDER_ENABLED_BIT = BIT2
+} wifi_event_bits_t;
+
+typedef struct {
+    char id[16];
+    uint8_t channel;
+    wifi_bandwidth_t bandwidth;
+    float position[3];
+    bool gateway;
+} anchor_config_t;
+
+typedef struct {
+    uint8_t data[ESP_NOW_MAX_DATA_LEN];
+    int len;
+    uint64_t rx_us;     /* SNTP time of arrival, echoed to the tag in the reply */
+} espnow_rx_t;
+
+typedef struct {
+    EventGroupHandle_t event_group;
+    esp_mqtt_client_handle_t mqtt_client;
+    uint8_t mac[6];
+    char mac_str[FTM_MAC_STR_LEN];
+    TaskHandle_t mqtt_task_handle;
+    QueueHandle_t espnow_queue;
+    volatile bool time_synced;
+    time_t last_mqtt_time;
+    uint8_t wifi_retry_count;
+    int16_t ftm_offset_cm;
+    char calib_topic[32];
+    char config_topic[32];
+    anchor_config_t config;
+    portMUX_TYPE plans_mux;
+    ftm_uplink_plan_t plans[GATEWAY_MAX_PLANS];
+    uint8_t plan_count;
+    uint8_t plan_next;
+} anchor_context_t;
+
+static anchor_context_t g_ctx = {.plans_mux = portMUX_INITIALIZER_UNLOCKED};
+
+static void mqtt_task(void *pvParameters);
+static void send_position_update(void);
+static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
+static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data);
+static void initialise_wifi(void);
+static void initialise_mqtt(void);
+static void load_ftm_offset(void);
+static void apply_ftm_offset(int16_t offset_cm, bool persist);
+static void handle_calibration_message(const char *data, int data_len);
+static void load_anchor_config(void);
+static void save_anchor_config(void);
+static void apply_radio_config(void);
+static void handle_config_message(const char *data, int data_len);
+static void handle_plan_message(const char *topic, int topic_len, const char *data, int data_len);
+static void send_plan(const uint8_t mac_tag[6], uint64_t rx_us);
+static void build_ap_ssid(char *ssid, size_t len);
+static void espnow_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int len);
+static void publish_gateway_batch(const char *json, size_t len, void *ctx);
+static void gateway_task(void *pvParameters);
+static void initialise_espnow(void);
+static void time_sync_cb(struct timeval *tv);
+static void initialise_sntp(void);
+static void sync_beacon_task(void *pvParameters);
+
+static void mqtt_task(void *pvParameters) {
+    TickType_t last_wake_time = xTaskGetTickCount();
+
+    while (1) {
+        EventBits_t bits = xEventGroupGetBits(g_ctx.event_group);
+        if (bits & WIFI_STA_CONNECTED_BIT) {
+            send_position_update();
+            g_ctx.last_mqtt_time = time(NULL);
+        }
+
+        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(MQTT_INTERVAL_MS));
+    }
+}
+
+/* Primary channel the radio is actually on; while the STA side is associated
+ * it is the infrastructure AP's, whatever the configured one */
+static uint8_t radio_channel(void) {
+    uint8_t primary = 0;
+    wifi_second_chan_t second;
+    if (esp_wifi_get_channel(&primary, &second) != ESP_OK || primary == 0) {
+        return g_ctx.config.channel;
+    }
+    return primary;
+}
+
+static void send_position_update(void) {
+    if (!g_ctx.mqtt_client) {
+        ESP_LOGW(TAG, "MQTT client not initialized");
+        return;
+    }
+
+    char json_buffer[256];
+    int written = snprintf(json_buffer, sizeof(json_buffer),
+                 "["
+                 "{"
+                 "\"mac_anchor\":\"%s\","
+                 "\"anchor_id\":\"%s\","
+                 "\"positionx\":%.1f,"
+                 "\"positiony\":%.1f,"
+                 "\"positionz\":%.1f,"
+                 "\"channel\":%u,"
+                 "\"ftm_offset_cm\":%d"
+                 "}"
+                 "]",
+                 g_ctx.mac_str, g_ctx.config.id, g_ctx.config.position[0], g_ctx.config.position[1],
+                 g_ctx.config.position[2], radio_channel(), g_ctx.ftm_offset_cm);
+
+    if (written >= sizeof(json_buffer)) {
+        ESP_LOGE(TAG, "JSON buffer overflow");
+        return;
+    }
+
+    int msg_id = esp_mqtt_client_publish(g_ctx.mqtt_client, MQTT_TOPIC, json_buffer, 0, 1, 0);
+    if (msg_id < 0) {
+        ESP_LOGE(TAG, "Failed to publish MQTT message");
+    } else {
+        ESP_LOGI(TAG, "Published MQTT message, msg_id=%d", msg_id);
+    }
+}
+
+static void load_ftm_offset(void) {
+    nvs_handle_t nvs;
+    g_ctx.ftm_offset_cm = 0;
+
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        ESP_LOGI(TAG, "No calibration stored, using FTM offset 0 cm");
+        return;
+    }
+    if (nvs_get_i16(nvs, NVS_KEY_FTM_OFFSET, &g_ctx.ftm_offset_cm) != ESP_OK) {
+        g_ctx.ftm_offset_cm = 0;
+    }
+    nvs_close(nvs);
+    ESP_LOGI(TAG, "Loaded FTM responder offset: %d cm", g_ctx.ftm_offset_cm);
+}
+
+/* The offset is subtracted by the responder from every distance the initiator
+ * computes, so it must equal (measured - reference) at a known distance. */
+static void apply_ftm_offset(int16_t offset_cm, bool persist) {
+    esp_err_t err = esp_wifi_ftm_resp_set_offset(offset_cm);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to set FTM responder offset: %s", esp_err_to_name(err));
+        return;
+    }
+    g_ctx.ftm_offset_cm = offset_cm;
+    ESP_LOGI(TAG, "FTM responder offset set to %d cm", offset_cm);
+
+    if (!persist) {
+        return;
+    }
+
+    nvs_handle_t nvs;
+    err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK) {
+        err = nvs_set_i16(nvs, NVS_KEY_FTM_OFFSET, offset_cm);
+        if (err == ESP_OK) {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store FTM offset in NVS: %s", esp_err_to_name(err));
+    }
+}
+
+static void load_anchor_config(void) {
+    anchor_config_t *cfg = &g_ctx.config;
+    strlcpy(cfg->id, DEFAULT_ANCHOR_ID, sizeof(cfg->id));
+    cfg->channel = DEFAULT_CHANNEL;
+    cfg->bandwidth = DEFAULT_BW;
+    cfg->position[0] = DEFAULT_POSITION_X;
+    cfg->position[1] = DEFAULT_POSITION_Y;
+    cfg->position[2] = DEFAULT_POSITION_Z;
+    cfg->gateway = DEFAULT_GATEWAY;
+
+    nvs_handle_t nvs;
+    if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK) {
+        ESP_LOGW(TAG, "Anchor not provisioned, using default configuration");
+        return;
+    }
+
+    size_t len = sizeof(cfg->id);
+    if (nvs_get_str(nvs, NVS_KEY_ID, cfg->id, &len) != ESP_OK) {
+        strlcpy(cfg->id, DEFAULT_ANCHOR_ID, sizeof(cfg->id));
+    }
+
+    uint8_t value;
+    if (nvs_get_u8(nvs, NVS_KEY_CHANNEL, &value) == ESP_OK && value >= 1 && value <= 13) {
+        cfg->channel = value;
+    }
+    if (nvs_get_u8(nvs, NVS_KEY_BW, &value) == ESP_OK && (value == WIFI_BW_HT20 || value == WIFI_BW_HT40)) {
+        cfg->bandwidth = (wifi_bandwidth_t)value;
+    }
+    if (nvs_get_u8(nvs, NVS_KEY_GATEWAY, &value) == ESP_OK) {
+        cfg->gateway = value != 0;
+    }
+
+    float position[3];
+    len = sizeof(position);
+    if (nvs_get_blob(nvs, NVS_KEY_POSITION, position, &len) == ESP_OK && len == sizeof(position)) {
+        memcpy(cfg->position, position, sizeof(position));
+    }
+    nvs_close(nvs);
+
+    ESP_LOGI(TAG, "Anchor %s: channel %u, %s, position (%.2f, %.2f, %.2f)%s",
+             cfg->id, cfg->channel, cfg->bandwidth == WIFI_BW_HT40 ? "HT40" : "HT20",
+             cfg->position[0], cfg->position[1], cfg->position[2],
+             cfg->gateway ? ", ESP-NOW gateway" : "");
+}
+
+static void save_anchor_config(void) {
+    const anchor_config_t *cfg = &g_ctx.config;
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open NVS: %s", esp_err_to_name(err));
+        return;
+    }
+
+    err = nvs_set_str(nvs, NVS_KEY_ID, cfg->id);
+    if (err == ESP_OK) {
+        err = nvs_set_u8(nvs, NVS_KEY_CHANNEL, cfg->channel);
+    }
+    if (err == ESP_OK) {
+        err = nvs_set_u8(nvs, NVS_KEY_BW, (uint8_t)cfg->bandwidth);
+    }
+    if (err == ESP_OK) {
+        err = nvs_set_blob(nvs, NVS_KEY_POSITION, cfg->position, sizeof(cfg->position));
+    }
+    if (err == ESP_OK) {
+        err = nvs_set_u8(nvs, NVS_KEY_GATEWAY, cfg->gateway ? 1 : 0);
+    }
+    if (err == ESP_OK) {
+        err = nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store anchor configuration: %s", esp_err_to_name(err));
+    }
+}
+
+/* While the STA side is associated the radio stays on the infrastructure AP
+ * channel, so the SoftAP only moves to the configured channel when that
+ * channel matches it or the STA is disconnected. */
+static void apply_radio_config(void) {
+    wifi_config_t ap_config;
+    ESP_ERROR_CHECK(esp_wifi_get_config(WIFI_IF_AP, &ap_config));
+    ap_config.ap.channel = g_ctx.config.channel;
+    build_ap_ssid((char *)ap_config.ap.ssid, sizeof(ap_config.ap.ssid));
+    ap_config.ap.ssid_len = strlen((char *)ap_config.ap.ssid);
+
+    esp_err_t err = esp_wifi_set_config(WIFI_IF_AP, &ap_config);
+    if (err == ESP_OK) {
+        err = esp_wifi_set_bandwidth(WIFI_IF_AP, g_ctx.config.bandwidth);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to apply radio configuration: %s", esp_err_to_name(err));
+        return;
+    }
+    uint8_t channel = radio_channel();
+    if (channel != g_ctx.config.channel) {
+        ESP_LOGW(TAG, "SoftAP stays on channel %u (STA associated), configured channel %u",
+                 channel, g_ctx.config.channel);
+    } else {
+        ESP_LOGI(TAG, "SoftAP on channel %u", channel);
+    }
+}
+
+static void handle_config_message(const char *data, int data_len) {
+    cJSON *root = cJSON_ParseWithLength(data, data_len);
+    if (root == NULL) {
+        ESP_LOGW(TAG, "Invalid configuration message");
+        return;
+    }
+
+    anchor_config_t *cfg = &g_ctx.config;
+    bool changed = false;
+    bool radio_changed = false;
+
+    const cJSON *item = cJSON_GetObjectItem(root, "anchor_id");
+    if (cJSON_IsString(item) && strcmp(item->valuestring, cfg->id) != 0) {
+        strlcpy(cfg->id, item->valuestring, sizeof(cfg->id));
+        changed = true;
+    }
+
+    item = cJSON_GetObjectItem(root, "channel");
+    if (cJSON_IsNumber(item) && item->valueint >= 1 && item->valueint <= 13 && item->valueint != cfg->channel) {
+        cfg->channel = (uint8_t)item->valueint;
+        radio_changed = true;
+    }
+
+    item = cJSON_GetObjectItem(root, "bandwidth");
+    if (cJSON_IsNumber(item) && (item->valueint == 20 || item->valueint == 40)) {
+        wifi_bandwidth_t bw = item->valueint == 40 ? WIFI_BW_HT40 : WIFI_BW_HT20;
+        if (bw != cfg->bandwidth) {
+            cfg->bandwidth = bw;
+            radio_changed = true;
+        }
+    }
+
+    item = cJSON_GetObjectItem(root, "gateway");
+    if (cJSON_IsBool(item) && cJSON_IsTrue(item) != cfg->gateway) {
+        cfg->gateway = cJSON_IsTrue(item);
+        radio_changed = true;
+    }
+
+    static const char *position_keys[3] = {"positionx", "positiony", "positionz"};
+    for (int i = 0; i < 3; i++) {
+        item = cJSON_GetObjectItem(root, position_keys[i]);
+        if (cJSON_IsNumber(item) && (float)item->valuedouble != cfg->position[i]) {
+            cfg->position[i] = (float)item->valuedouble;
+            changed = true;
+        }
+    }
+    cJSON_Delete(root);
+
+    if (!changed && !radio_changed) {
+        return;
+    }
+
+    save_anchor_config();
+    if (radio_changed) {
+        apply_radio_config();
+    }
+    if (cfg->gateway && g_ctx.mqtt_client) {
+        esp_mqtt_client_subscribe(g_ctx.mqtt_client, MQTT_PLAN_TOPIC "+", 1);
+    }
+    ESP_LOGI(TAG, "Configuration updated: anchor %s, channel %u, position (%.2f, %.2f, %.2f)",
+             cfg->id, cfg->channel, cfg->position[0], cfg->position[1], cfg->position[2]);
+    send_position_update();
+}
+
+/* plan/<tag MAC> carries {"anchors": ["AA:BB:CC:DD:EE:FF", ...]}; an empty
+ * list lets the tag range every anchor again */
+static void handle_plan_message(const char *topic, int topic_len, const char *data, int data_len) {
+    const int prefix_len = strlen(MQTT_PLAN_TOPIC);
+    ftm_uplink_plan_t plan = {0};
+
+    if (!g_ctx.config.gateway ||
+        ftm_mac_parse(topic + prefix_len, topic_len - prefix_len, plan.mac_tag) != 0) {
+        return;
+    }
+
+    if (ftm_uplink_plan_from_json(data, data_len, &plan) != 0) {
+        ESP_LOGW(TAG, "Invalid ranging plan for %.*s", topic_len - prefix_len, topic + prefix_len);
+        return;
+    }
+
+    /* replace the tag's plan, or take a free slot (the oldest one when full) */
+    taskENTER_CRITICAL(&g_ctx.plans_mux);
+    int slot = -1;
+    for (int i = 0; i < g_ctx.plan_count; i++) {
+        if (memcmp(g_ctx.plans[i].mac_tag, plan.mac_tag, 6) == 0) {
+            slot = i;
+            break;
+        }
+    }
+    if (slot < 0 && g_ctx.plan_count < GATEWAY_MAX_PLANS) {
+        slot = g_ctx.plan_count++;
+    } else if (slot < 0) {
+        slot = g_ctx.plan_next;
+        g_ctx.plan_next = (g_ctx.plan_next + 1) % GATEWAY_MAX_PLANS;
+    }
+    g_ctx.plans[slot] = plan;
+    taskEXIT_CRITICAL(&g_ctx.plans_mux);
+}
+
+static uint64_t epoch_us(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (uint64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/* Broadcast so the gateway needs no peer per tag; the tag recognises its reply
+ * by the MAC inside it. A lost plan is sent again after the next round. The
+ * reply goes out even without a plan, because it also carries the time. */
+static void send_plan(const uint8_t mac_tag[6], uint64_t rx_us) {
+    static const uint8_t broadcast[ESP_NOW_ETH_ALEN] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+    ftm_uplink_plan_t plan = {0};
+
+    taskENTER_CRITICAL(&g_ctx.plans_mux);
+    for (int i = 0; i < g_ctx.plan_count; i++) {
+        if (memcmp(g_ctx.plans[i].mac_tag, mac_tag, 6) == 0) {
+            plan = g_ctx.plans[i];
+            break;
+        }
+    }
+    taskEXIT_CRITICAL(&g_ctx.plans_mux);
+
+    memcpy(plan.mac_tag, mac_tag, 6);
+    if (g_ctx.time_synced) {
+        plan.flags |= FTM_UPLINK_PLAN_TIME;
+        plan.rx_us = rx_us;
+        plan.tx_us = epoch_us();
+    }
+    if (!(plan.flags & (FTM_UPLINK_PLAN_ANCHORS | FTM_UPLINK_PLAN_TIME))) {
+        return;
+    }
+
+    uint8_t buf[FTM_UPLINK_PLAN_SIZE(FTM_UPLINK_PLAN_MAX)];
+    size_t len = ftm_uplink_encode_plan(&plan, buf, sizeof(buf));
+    if (len == 0 || esp_now_send(broadcast, buf, len) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to send ranging plan to " MACSTR, MAC2STR(mac_tag));
+    }
+}
+
+/* Gateway anchors advertise a distinct SSID prefix so tags can find them in
+ * the scan they already do for FTM responders */
+static void build_ap_ssid(char *ssid, size_t len) {
+    const uint8_t *mac = g_ctx.mac;
+    snprintf(ssid, len, "%s%02X%02X%02X%02X%02X%02X",
+             g_ctx.config.gateway ? FTM_UPLINK_SSID_PREFIX : "ftm_",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
+
+/* Runs in the Wi-Fi task: only copy the frame and hand it to gateway_task */
+static void espnow_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
+    if (!g_ctx.config.gateway || len <= 0 || len > ESP_NOW_MAX_DATA_LEN) {
+        return;
+    }
+
+    espnow_rx_t rx;
+    rx.rx_us = epoch_us();
+    memcpy(rx.data, data, len);
+    rx.len = len;
+    if (xQueueSend(g_ctx.espnow_queue, &rx, 0) != pdTRUE) {
+        ESP_LOGW(TAG, "ESP-NOW queue full, dropping report from " MACSTR, MAC2STR(info->src_addr));
+    }
+}
+
+static void publish_gateway_batch(const char *json, size_t len, void *ctx) {
+    if (!g_ctx.mqtt_client || !(xEventGroupGetBits(g_ctx.event_group) & WIFI_STA_CONNECTED_BIT)) {
+        ESP_LOGW(TAG, "Uplink not available, dropping ESP-NOW batch");
+        return;
+    }
+
+    int msg_id = esp_mqtt_client_publish(g_ctx.mqtt_client, MQTT_TOPIC, json, (int)len, 1, 0);
+    if (msg_id < 0) {
+        ESP_LOGE(TAG, "Failed to forward ESP-NOW batch");
+    } else {
+        ESP_LOGI(TAG, "Forwarded ESP-NOW batch, msg_id=%d", msg_id);
+    }
+}
+
+static void gateway_task(void *pvParameters) {
+    static char json[ESPNOW_JSON_SIZE];
+    ftm_uplink_batch_t batch;
+    ftm_uplink_frame_t frame;
+    espnow_rx_t rx;
+
+    ftm_uplink_batch_init(&batch, json, sizeof(json), publish_gateway_batch, NULL);
+
+    while (1) {
+        if (xQueueReceive(g_ctx.espnow_queue, &rx, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        TickType_t start = xTaskGetTickCount();
+        TickType_t elapsed;
+        int frames = 0;
+
+        do {
+            if (ftm_uplink_decode(rx.data, rx.len, &frame) != 0) {
+                ESP_LOGW(TAG, "Ignoring malformed ESP-NOW frame (%d bytes)", rx.len);
+                continue;
+            }
+            /* the tag waits on this channel for its plan right after the round */
+            send_plan(frame.header.mac_src, rx.rx_us);
+
+            if (ftm_uplink_batch_add(&batch, &frame) != 0) {
+                ESP_LOGE(TAG, "ESP-NOW report from " MACSTR " does not fit in a batch", MAC2STR(frame.header.mac_src));
+                continue;
+            }
+            frames++;
+        } while (frames < ESPNOW_BATCH_MAX &&
+                 (elapsed = xTaskGetTickCount() - start) < pdMS_TO_TICKS(ESPNOW_BATCH_MS) &&
+                 xQueueReceive(g_ctx.espnow_queue, &rx, pdMS_TO_TICKS(ESPNOW_BATCH_MS) - elapsed) == pdTRUE);
+
+        ftm_uplink_batch_flush(&batch);
+    }
+}
+
+static void initialise_espnow(void) {
+    g_ctx.espnow_queue = xQueueCreate(ESPNOW_QUEUE_LEN, sizeof(espnow_rx_t));
+    if (g_ctx.espnow_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create ESP-NOW queue");
+        return;
+    }
+
+    ESP_ERROR_CHECK(esp_now_init());
+    ESP_ERROR_CHECK(esp_now_register_recv_cb(espnow_recv_cb));
+
+    esp_now_peer_info_t broadcast = {
+        .peer_addr = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF},
+        .channel = 0,
+        .ifidx = WIFI_IF_AP,
+        .encrypt = false,
+    };
+    ESP_ERROR_CHECK(esp_now_add_peer(&broadcast));
+
+    if (xTaskCreate(gateway_task, "gateway_task", 4096, NULL, 5, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create gateway task");
+    }
+}
+
+static void time_sync_cb(struct timeval *tv) {
+    if (!g_ctx.time_synced) {
+        ESP_LOGI(TAG, "Time synchronised with %s", SNTP_SERVER);
+    }
+    g_ctx.time_synced = true;
+}
+
+static void initialise_sntp(void) {
+    esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    esp_sntp_setservername(0, SNTP_SERVER);
+    /* slew instead of stepping so beacon time never jumps backwards */
+    sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+    sntp_set_time_sync_notification_cb(time_sync_cb);
+    esp_sntp_init();
+}
+
+/* Publishes the current SNTP time in a vendor IE of the SoftAP beacons and
+ * probe responses. Tags read it while scanning and timestamp their results.
+ * The value is up to SYNC_IE_PERIOD_MS old when sent, so a tag that has only
+ * this time is behind the anchors by 0 to 100 ms, on top of the SNTP error. */
+static void sync_beacon_task(void *pvParameters) {
+    static const uint8_t oui[3] = FTM_SYNC_OUI;
+    uint8_t ie_buf[sizeof(vendor_ie_data_t) + FTM_SYNC_PAYLOAD_LEN];
+    vendor_ie_data_t *ie = (vendor_ie_data_t *)ie_buf;
+
+    ie->element_id = WIFI_VENDOR_IE_ELEMENT_ID;
+    ie->length = sizeof(oui) + 1 + FTM_SYNC_PAYLOAD_LEN;
+    memcpy(ie->vendor_oui, oui, sizeof(oui));
+    ie->vendor_oui_type = FTM_SYNC_OUI_TYPE;
+
+    bool installed = false;
+    TickType_t last_wake_time = xTaskGetTickCount();
+
+    while (1) {
+        struct timeval tv;
+        gettimeofday(&tv, NULL);
+        uint64_t epoch_ms = (uint64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+        ftm_sync_pack(ie->payload, epoch_ms, g_ctx.time_synced);
+
+        /* an installed IE has to be removed before it can be replaced */
+        if (installed) {
+            esp_wifi_set_vendor_ie(false, WIFI_VND_IE_TYPE_BEACON, WIFI_VND_IE_ID_0, ie);
+            esp_wifi_set_vendor_ie(false, WIFI_VND_IE_TYPE_PROBE_RESP, WIFI_VND_IE_ID_0, ie);
+        }
+        installed = esp_wifi_set_vendor_ie(true, WIFI_VND_IE_TYPE_BEACON, WIFI_VND_IE_ID_0, ie) == ESP_OK &&
+                    esp_wifi_set_vendor_ie(true, WIFI_VND_IE_TYPE_PROBE_RESP, WIFI_VND_IE_ID_0, ie) == ESP_OK;
+
+        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(SYNC_IE_PERIOD_MS));
+    }
+}
+
+static void handle_calibration_message(const char *data, int data_len) {
+    cJSON *root = cJSON_ParseWithLength(data, data_len);
+    if (root == NULL) {
+        ESP_LOGW(TAG, "Invalid calibration message");
+        return;
+    }
+
+    const cJSON *offset = cJSON_GetObjectItem(root, "offset_cm");
+    if (cJSON_IsNumber(offset) && offset->valuedouble >= INT16_MIN && offset->valuedouble <= INT16_MAX) {
+        int16_t offset_cm = (int16_t)offset->valuedouble;
+        if (offset_cm != g_ctx.ftm_offset_cm) {
+            apply_ftm_offset(offset_cm, true);
+            send_position_update();
+        }
+    } else {
+        ESP_LOGW(TAG, "Calibration message without a valid offset_cm");
+    }
+    cJSON_Delete(root);
+}
+
+static void wifi_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    if (event_base == WIFI_EVENT) {
+        switch (event_id) {
+            case WIFI_EVENT_AP_START:
+                ESP_LOGI(TAG, "SoftAP started");
+                xEventGroupSetBits(g_ctx.event_group, WIFI_AP_START_BIT);
+                break;
+
+            case WIFI_EVENT_AP_STACONNECTED: {
+                wifi_event_ap_staconnected_t *event = (wifi_event_ap_staconnected_t *)event_data;
+                ESP_LOGI(TAG, "Station connected to AP: " MACSTR ", AID=%d",
+                         MAC2STR(event->mac), event->aid);
+                break;
+            }
+
+            case WIFI_EVENT_AP_STADISCONNECTED: {
+                wifi_event_ap_stadisconnected_t *event = (wifi_event_ap_stadisconnected_t *)event_data;
+                ESP_LOGI(TAG, "Station disconnected from AP: " MACSTR ", AID=%d",
+                         MAC2STR(event->mac), event->aid);
+                break;
+            }
+
+            case WIFI_EVENT_STA_START:
+                esp_wifi_connect();
+                break;
+
+            case WIFI_EVENT_STA_CONNECTED:
+                ESP_LOGI(TAG, "Connected to AP for MQTT");
+                g_ctx.wifi_retry_count = 0;
+                xEventGroupSetBits(g_ctx.event_group, WIFI_STA_CONNECTED_BIT);
+                break;
+
+            case WIFI_EVENT_STA_DISCONNECTED:
+                ESP_LOGI(TAG, "Disconnected from AP, attempting reconnection...");
+                esp_wifi_connect();
+                xEventGroupClearBits(g_ctx.event_group, WIFI_STA_CONNECTED_BIT);
+                break;
+
+            default:
+                break;
+        }
+    } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
+        ip_event_got_ip_t *event = (ip_event_got_ip_t *)event_data;
+        ESP_LOGI(TAG, "Got IP address: " IPSTR, IP2STR(&event->ip_info.ip));
+        xEventGroupSetBits(g_ctx.event_group, WIFI_STA_CONNECTED_BIT);
+    }
+}
+
+static void initialise_mqtt(void) {
+    /* The MAC, not the anchor id: unprovisioned anchors all share the default
+     * id and would keep taking over each other's session */
+    char client_id[32];
+    snprintf(client_id, sizeof(client_id), "esp32_anchor_%s", g_ctx.mac_str);
+
+    esp_mqtt_client_config_t mqtt_cfg = {
+        .broker.address.uri = MQTT_URI,
+        .credentials.client_id = client_id,
+        .session.keepalive = 60,
+    };
+
+    g_ctx.mqtt_client = esp_mqtt_client_init(&mqtt_cfg);
+    if (g_ctx.mqtt_client == NULL) {
+        ESP_LOGE(TAG, "Failed to initialize MQTT client");
+        return;
+    }
+
+    ESP_ERROR_CHECK(esp_mqtt_client_register_event(g_ctx.mqtt_client, ESP_EVENT_ANY_ID, mqtt_event_handler, NULL));
+    ESP_ERROR_CHECK(esp_mqtt_client_start(g_ctx.mqtt_client));
+    ESP_LOGI(TAG, "MQTT client started");
+}
+
+static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data) {
+    esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)event_data;
+    switch (event_id) {
+        case MQTT_EVENT_CONNECTED:
+            ESP_LOGI(TAG, "MQTT connected");
+            esp_mqtt_client_subscribe(g_ctx.mqtt_client, g_ctx.calib_topic, 1);
+            esp_mqtt_client_subscribe(g_ctx.mqtt_client, g_ctx.config_topic, 1);
+            if (g_ctx.config.gateway) {
+                esp_mqtt_client_subscribe(g_ctx.mqtt_client, MQTT_PLAN_TOPIC "+", 1);
+            }
+            break;
+
+        case MQTT_EVENT_DISCONNECTED:
+            ESP_LOGI(TAG, "MQTT disconnected");
+            break;
+
+        case MQTT_EVENT_DATA:
+            ESP_LOGI(TAG, "MQTT message received: %.*s", event->data_len, event->data);
+            if (event->topic_len == strlen(g_ctx.calib_topic) &&
+                strncmp(event->topic, g_ctx.calib_topic, event->topic_len) == 0) {
+                handle_calibration_message(event->data, event->data_len);
+            } else if (event->topic_len == strlen(g_ctx.config_topic) &&
+                       strncmp(event->topic, g_ctx.config_topic, event->topic_len) == 0) {
+                handle_config_message(event->data, event->data_len);
+            } else if (event->topic_len > (int)strlen(MQTT_PLAN_TOPIC) &&
+                       strncmp(event->topic, MQTT_PLAN_TOPIC, strlen(MQTT_PLAN_TOPIC)) == 0) {
+                handle_plan_message(event->topic, event->topic_len, event->data, event->data_len);
+            }
+            break;
+
+        case MQTT_EVENT_ERROR:
+            ESP_LOGE(TAG, "MQTT error occurred");
+            esp_mqtt_client_stop(g_ctx.mqtt_client);
+            esp_mqtt_client_start(g_ctx.mqtt_client);
+            break;
+
+        default:
+            ESP_LOGD(TAG, "Unhandled MQTT event: %ld", event_id);
+            break;
+    }
+}
+
+static void initialise_wifi(void) {
+    ESP_ERROR_CHECK(esp_netif_init());
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+
+    g_ctx.event_group = xEventGroupCreate();
+    if (g_ctx.event_group == NULL) {
+        ESP_LOGE(TAG, "Failed to create event group");
+        return;
+    }
+
+    esp_netif_create_default_wifi_ap();
+    esp_netif_create_default_wifi_sta();
+
+    wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_wifi_init(&cfg));
+
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_event_handler, NULL, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &wifi_event_handler, NULL, NULL));
+
+    ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_APSTA));
+
+    uint8_t *mac = g_ctx.mac;
+    ESP_ERROR_CHECK(esp_read_mac(mac, ESP_MAC_WIFI_SOFTAP));
+    ftm_mac_format(mac, g_ctx.mac_str);
+    snprintf(g_ctx.calib_topic, sizeof(g_ctx.calib_topic), MQTT_CALIB_TOPIC "%s", g_ctx.mac_str);
+    snprintf(g_ctx.config_topic, sizeof(g_ctx.config_topic), MQTT_CONFIG_TOPIC "%s", g_ctx.mac_str);
+
+    char ssid[32];
+    build_ap_ssid(ssid, sizeof(ssid));
+
+    wifi_config_t ap_config = {
+        .ap = {
+            .ssid_len = strlen(ssid),
+            .channel = g_ctx.config.channel,
+            .max_connection = 4,
+            .authmode = WIFI_AUTH_OPEN,
+            .ftm_responder = true,
+            .pairwise_cipher = WIFI_CIPHER_TYPE_CCMP,
+        },
+    };
+    strlcpy((char *)ap_config.ap.ssid, ssid, sizeof(ap_config.ap.ssid));
+
+    wifi_config_t sta_config = {
+        .sta = {
+            .threshold.authmode = WIFI_AUTH_WPA2_PSK,
+            .sae_pwe_h2e = WPA3_SAE_PWE_BOTH,
+        },
+    };
+    strlcpy((char *)sta_config.sta.ssid, WIFI_SSID, sizeof(sta_config.sta.ssid));
+    strlcpy((char *)sta_config.sta.password, WIFI_PASS, sizeof(sta_config.sta.password));
+
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_AP, &ap_config));
+    ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &sta_config));
+    ESP_ERROR_CHECK(esp_wifi_set_bandwidth(WIFI_IF_AP, g_ctx.config.bandwidth));
+    ESP_ERROR_CHECK(esp_wifi_start());
+    apply_ftm_offset(g_ctx.ftm_offset_cm, false);
+
+    ESP_LOGI(TAG, "WiFi initialized in APSTA mode");
+    ESP_LOGI(TAG, "AP SSID: %s (FTM Responder)", ssid);
+}
+
+void app_main(void) {
+
+    esp_err_t ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+
+    load_anchor_config();
+    load_ftm_offset();
+    initialise_wifi();
+
+    ESP_LOGI(TAG, "Waiting for WiFi connections...");
+    EventBits_t bits = xEventGroupWaitBits(g_ctx.event_group, WIFI_AP_START_BIT | WIFI_STA_CONNECTED_BIT, pdFALSE, pdTRUE, pdMS_TO_TICKS(30000));
+
+    if ((bits & (WIFI_AP_START_BIT | WIFI_STA_CONNECTED_BIT)) != (WIFI_AP_START_BIT | WIFI_STA_CONNECTED_BIT)) {
+        ESP_LOGW(TAG, "WiFi initialization timeout, continuing anyway...");
+    }
+
+    initialise_sntp();
+    initialise_mqtt();
+    initialise_espnow();
+
+    if (xTaskCreate(sync_beacon_task, "sync_beacon_task", 3072, NULL, 6, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create sync beacon task");
+    }
+
+    BaseType_t task_created;
+    task_created = xTaskCreate(mqtt_task, "mqtt_task", 4096, NULL, 5, &g_ctx.mqtt_task_handle);
+    if (task_created != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create MQTT task");
+        return;
+    }
+
+    ESP_LOGI(TAG, "All tasks created successfully");
+
+    ESP_LOGI(TAG, "FTM Responder is up and running");
+}
+
+
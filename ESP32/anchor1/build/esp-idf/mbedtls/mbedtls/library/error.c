@@ -1 +0,0 @@
-/home/lucia/esp/v5.3.1/esp-idf/components/mbedtls/mbedtls/library/error.c
\ No newline at end of file
@@ -1 +0,0 @@
-/home/lucia/esp/v5.3.1/esp-idf/components/mbedtls/mbedtls/library/psa_crypto_driver_wrappers_no_static.c
\ No newline at end of file
@@ -1,21 +0,0 @@
-set(CMAKE_ASM_COMPILER "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-gcc")
-set(CMAKE_ASM_COMPILER_ARG1 "")
-set(CMAKE_AR "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-ar")
-set(CMAKE_ASM_COMPILER_AR "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-gcc-ar")
-set(CMAKE_RANLIB "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-ranlib")
-set(CMAKE_ASM_COMPILER_RANLIB "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-gcc-ranlib")
-set(CMAKE_LINKER "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/xtensa-esp32s3-elf-ld")
-set(CMAKE_MT "")
-set(CMAKE_ASM_COMPILER_LOADED 1)
-set(CMAKE_ASM_COMPILER_ID "GNU")
-set(CMAKE_ASM_COMPILER_VERSION "")
-set(CMAKE_ASM_COMPILER_ENV_VAR "ASM")
-
-
-set(CMAKE_ASM_COMPILER_SYSROOT "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/../xtensa-esp-elf/usr")
-set(CMAKE_COMPILER_SYSROOT "/home/lucia/.espressif/tools/xtensa-esp-elf/esp-13.2.0_20240530/xtensa-esp-elf/bin/../xtensa-esp-elf/usr")
-
-set(CMAKE_ASM_IGNORE_EXTENSIONS h;H;o;O;obj;OBJ;def;DEF;rc;RC)
-set(CMAKE_ASM_LINKER_PREFERENCE 0)
-
-
@@ -1,12 +0,0 @@
-# Additional clean files
-cmake_minimum_required(VERSION 3.16)
-
-if("${CONFIG}" STREQUAL "" OR "${CONFIG}" STREQUAL "")
-  file(REMOVE_RECURSE
-  "bootloader.bin"
-  "bootloader.map"
-  "config/sdkconfig.cmake"
-  "config/sdkconfig.h"
-  "project_elf_src_esp32s3.c"
-  )
-endif()
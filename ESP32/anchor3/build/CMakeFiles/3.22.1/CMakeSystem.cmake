@@ -1,15 +0,0 @@
-set(CMAKE_HOST_SYSTEM "Linux-6.8.0-49-generic")
-set(CMAKE_HOST_SYSTEM_NAME "Linux")
-set(CMAKE_HOST_SYSTEM_VERSION "6.8.0-49-generic")
-set(CMAKE_HOST_SYSTEM_PROCESSOR "x86_64")
-
-include("/home/lucia/esp/v5.3.1/esp-idf/tools/cmake/toolchain-esp32s3.cmake")
-
-set(CMAKE_SYSTEM "Generic")
-set(CMAKE_SYSTEM_NAME "Generic")
-set(CMAKE_SYSTEM_VERSION "")
-set(CMAKE_SYSTEM_PROCESSOR "")
-
-set(CMAKE_CROSSCOMPILING "TRUE")
-
-set(CMAKE_SYSTEM_LOADED 1)
@@ -0,0 +1,56 @@
+#include <stdio.h>
+#include "ftm_mac.h"
+
+static int hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+int ftm_mac_parse(const char *str, size_t len, uint8_t mac[6]) {
+    if (len != FTM_MAC_STR_LEN - 1) {
+        return -1;
+    }
+
+    const char sep = str[2];
+    if (sep != ':' && sep != '-') {
+        return -1;
+    }
+    for (int i = 0; i < 6; i++) {
+        const char *p = str + 3 * i;
+        int hi = hex_value(p[0]);
+        int lo = hex_value(p[1]);
+        if (hi < 0 || lo < 0 || (i < 5 && p[2] != sep)) {
+            return -1;
+        }
+        mac[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return 0;
+}
+
+void ftm_mac_format(const uint8_t mac[6], char str[FTM_MAC_STR_LEN]) {
+    snprintf(str, FTM_MAC_STR_LEN, "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
+
+uint64_t ftm_mac_to_u64(const uint8_t mac[6]) {
+    uint64_t value = 0;
+    for (int i = 0; i < 6; i++) {
+        value = (value << 8) | mac[i];
+    }
+    return value;
+}
+
+void ftm_mac_from_u64(uint64_t value, uint8_t mac[6]) {
+    for (int i = 5; i >= 0; i--) {
+        mac[i] = value & 0xFF;
+        value >>= 8;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* MAC address helpers shared by the firmware and the ingest daemon, so the
+ * text form sent over MQTT and the 48-bit key stored in devices.mac (macaddr)
+ * are produced and parsed in one place. */
+
+#define FTM_MAC_STR_LEN 18  /* "AA:BB:CC:DD:EE:FF" plus the terminator */
+
+/* Parses "AA:BB:CC:DD:EE:FF" (':' or '-' separators, any case), the form
+ * PostgreSQL also prints for macaddr. Returns 0 on success, -1 otherwise. */
+int ftm_mac_parse(const char *str, size_t len, uint8_t mac[6]);
+
+/* Writes the uppercase, colon separated form used in the MQTT payloads */
+void ftm_mac_format(const uint8_t mac[6], char str[FTM_MAC_STR_LEN]);
+
+/* The address as a 48-bit integer, most significant byte first */
+uint64_t ftm_mac_to_u64(const uint8_t mac[6]);
+
+void ftm_mac_from_u64(uint64_t value, uint8_t mac[6]);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,197 @@
+// Host benchmark of ftm_multilat.hpp: latency of one fix for several anchor
+// counts, batch throughput on one and on all threads, in double and float, and
+// the error with NLOS outliers with and without the robust stage. Built by ingesta/CMakeLists.txt
+// (FTM_NATIVE=ON adds -march=native so the compiler can use AVX2/AVX-512).
+
+#include "ftm_multilat.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// keeps the optimiser from discarding the fixes
+volatile double sink;
+
+template <typename T>
+struct Scenario {
+    size_t n_anchors;
+    size_t n_tags;
+    std::vector<T> anchors;
+    std::vector<T> distances;
+    std::vector<T> variances;
+    std::vector<double> truth;
+};
+
+template <typename T>
+Scenario<T> make_scenario(size_t n_anchors, size_t n_tags, double missing, double nlos = 0.0)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> site(0.0, 30.0);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    std::normal_distribution<double> noise(0.0, 0.1);
+
+    std::uniform_real_distribution<double> bias(1.0, 5.0);
+
+    Scenario<T> s{n_anchors, n_tags, {}, {}, {}, {}};
+    for (size_t i = 0; i < n_anchors; ++i) {
+        s.anchors.push_back(static_cast<T>(site(rng)));
+        s.anchors.push_back(static_cast<T>(site(rng)));
+    }
+    for (size_t t = 0; t < n_tags; ++t) {
+        double x = site(rng), y = site(rng);
+        s.truth.push_back(x);
+        s.truth.push_back(y);
+        for (size_t i = 0; i < n_anchors; ++i) {
+            double d = std::hypot(x - s.anchors[2 * i], y - s.anchors[2 * i + 1]) + noise(rng);
+            // NLOS: the path is longer than the direct one
+            if (coin(rng) < nlos) {
+                d += bias(rng);
+            }
+            // the first three anchors are always present so every tag is solvable
+            bool present = i < 3 || coin(rng) >= missing;
+            s.distances.push_back(present ? static_cast<T>(d) : static_cast<T>(NAN));
+            s.variances.push_back(static_cast<T>(0.01));
+        }
+    }
+    return s;
+}
+
+// median over runs of the time per fix of solving every tag one call at a time
+template <typename T>
+double latency_ns(const Scenario<T> &s)
+{
+    std::vector<double> runs;
+    for (int run = 0; run < 21; ++run) {
+        double acc = 0;
+        auto start = Clock::now();
+        for (size_t t = 0; t < s.n_tags; ++t) {
+            ftm::Fix<T> fix = ftm::multilaterate(s.anchors.data(), &s.distances[t * s.n_anchors],
+                                                 &s.variances[t * s.n_anchors], s.n_anchors);
+            acc += fix.x;
+        }
+        runs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / s.n_tags);
+        sink = acc;
+    }
+    std::nth_element(runs.begin(), runs.begin() + runs.size() / 2, runs.end());
+    return runs[runs.size() / 2];
+}
+
+template <typename T>
+double batch_fixes_per_s(const Scenario<T> &s, unsigned threads, size_t &solved)
+{
+    std::vector<ftm::Fix<T>> fixes(s.n_tags);
+    ftm::MultilatOptions<T> opt;
+    opt.threads = threads;
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        auto start = Clock::now();
+        solved = ftm::multilaterate_batch(s.anchors.data(), s.n_anchors, s.distances.data(),
+                                          s.variances.data(), s.n_tags, fixes.data(), nullptr, opt);
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        best = std::max(best, s.n_tags / seconds);
+        sink = fixes[0].x;
+    }
+    return best;
+}
+
+// median position error and mean rejected anchors per fix
+template <typename T>
+void accuracy(const Scenario<T> &s, const ftm::MultilatOptions<T> &opt, const char *label)
+{
+    std::vector<ftm::Fix<T>> fixes(s.n_tags);
+    ftm::multilaterate_batch(s.anchors.data(), s.n_anchors, s.distances.data(), s.variances.data(),
+                             s.n_tags, fixes.data(), nullptr, opt);
+    std::vector<double> errors;
+    size_t rejected = 0;
+    for (size_t t = 0; t < s.n_tags; ++t) {
+        if (fixes[t].status == ftm::MultilatStatus::ok) {
+            errors.push_back(std::hypot(fixes[t].x - s.truth[2 * t], fixes[t].y - s.truth[2 * t + 1]));
+            for (uint64_t mask = fixes[t].rejected; mask; mask &= mask - 1) {
+                ++rejected;
+            }
+        }
+    }
+    std::sort(errors.begin(), errors.end());
+    std::printf("  %-24s error p50 %.2f m, p90 %.2f m, %.2f anchors rejected per fix\n", label,
+                errors[errors.size() / 2], errors[errors.size() * 9 / 10],
+                static_cast<double>(rejected) / errors.size());
+}
+
+// fixed-size entry point, anchor count known at compile time
+template <typename T, size_t N>
+double fixed_latency_ns(const Scenario<T> &s)
+{
+    std::array<T, 2 * N> anchors;
+    std::copy_n(s.anchors.begin(), 2 * N, anchors.begin());
+    std::vector<double> runs;
+    for (int run = 0; run < 21; ++run) {
+        double acc = 0;
+        auto start = Clock::now();
+        for (size_t t = 0; t < s.n_tags; ++t) {
+            std::array<T, N> d, v;
+            std::copy_n(&s.distances[t * N], N, d.begin());
+            std::copy_n(&s.variances[t * N], N, v.begin());
+            acc += ftm::multilaterate<N>(anchors, d, v).x;
+        }
+        runs.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count() / s.n_tags);
+        sink = acc;
+    }
+    std::nth_element(runs.begin(), runs.begin() + runs.size() / 2, runs.end());
+    return runs[runs.size() / 2];
+}
+
+template <typename T>
+void run(const char *type)
+{
+    std::printf("%s\n", type);
+    for (size_t n : {3, 4, 6, 8, 12, 16}) {
+        Scenario<T> s = make_scenario<T>(n, 10000, 0.2);
+        std::printf("  %2zu anchors: %7.1f ns/fix", n, latency_ns(s));
+        if (n == 4) {
+            std::printf("  (std::array<%zu>: %.1f ns/fix)", n, fixed_latency_ns<T, 4>(s));
+        }
+        std::printf("\n");
+    }
+
+    Scenario<T> s = make_scenario<T>(8, 100000, 0.2);
+    size_t solved = 0;
+    for (unsigned threads : {1u, 0u}) {
+        double rate = batch_fixes_per_s(s, threads, solved);
+        std::printf("  batch %zu tags x 8 anchors, %s: %.2f M fixes/s (%zu solved)\n", s.n_tags,
+                    threads ? "1 thread" : "all threads", rate / 1e6, solved);
+    }
+
+    Scenario<T> nlos = make_scenario<T>(8, 20000, 0.2, 0.15);
+    std::printf("  8 anchors, 15%% NLOS ranges (+1..5 m):\n");
+    ftm::MultilatOptions<T> plain;
+    plain.loss = ftm::MultilatLoss::squared;
+    plain.ransac_min_anchors = 0;
+    accuracy(nlos, plain, "least squares");
+    accuracy(nlos, ftm::MultilatOptions<T>{}, "Huber + RANSAC");
+    ftm::MultilatOptions<T> tukey;
+    tukey.loss = ftm::MultilatLoss::tukey;
+    accuracy(nlos, tukey, "Tukey + RANSAC");
+}
+
+}  // namespace
+
+int main()
+{
+#if defined(__AVX512F__)
+    std::printf("SIMD: AVX-512\n");
+#elif defined(__AVX2__)
+    std::printf("SIMD: AVX2\n");
+#elif defined(__SSE2__)
+    std::printf("SIMD: SSE2 (build with -DFTM_NATIVE=ON for the local CPU)\n");
+#endif
+    run<double>("double");
+    run<float>("float");
+    return 0;
+}
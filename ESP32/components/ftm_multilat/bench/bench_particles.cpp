@@ -0,0 +1,193 @@
+// Host benchmark of ftm_particles.hpp: particles per second and latency of one
+// fix (predict, weight with one round of ranges, estimate and resample) for
+// 1k to 100k particles, on one and on all threads, and the error of a tag
+// walking a corridor with NLOS ranges against the robust multilateration.
+// Built by ingesta/CMakeLists.txt (FTM_NATIVE=ON adds -march=native so the
+// compiler can use AVX2/AVX-512).
+
+#include "ftm_multilat.hpp"
+#include "ftm_particles.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+volatile float sink;
+
+// 40 x 30 m at 5 cm: outer walls, two rooms along a 3 m corridor at y = 12..15
+// with a door into each
+struct Site {
+    static constexpr float resolution = 0.05f;
+    static constexpr size_t width = 800, height = 600;
+    std::vector<uint8_t> grid = std::vector<uint8_t>(width * height, 0);
+    std::vector<float> anchors = {2, 2, 38, 2, 38, 28, 2, 28, 20, 13.5f, 10, 22};
+
+    void wall(float x0, float y0, float x1, float y1)
+    {
+        for (size_t y = size_t(y0 / resolution); y <= size_t(y1 / resolution) && y < height; ++y) {
+            for (size_t x = size_t(x0 / resolution); x <= size_t(x1 / resolution) && x < width; ++x) {
+                grid[y * width + x] = 1;
+            }
+        }
+    }
+
+    Site()
+    {
+        wall(0, 0, 40, 0.2f);
+        wall(0, 29.8f, 40, 30);
+        wall(0, 0, 0.2f, 30);
+        wall(39.8f, 0, 40, 30);
+        // corridor walls, with a 1 m door into each side
+        wall(0, 11.8f, 19, 12);
+        wall(20, 11.8f, 40, 12);
+        wall(0, 15, 29, 15.2f);
+        wall(30, 15, 40, 15.2f);
+        wall(20, 0, 20.2f, 11.8f);
+    }
+};
+
+// One round of ranges from (x, y): NLOS ranges with probability nlos, anchors
+// that do not answer with probability miss and, when a plan is given, anchors
+// behind a wall that do not answer with probability loss
+std::vector<float> ranges_at(const Site &site, float x, float y, std::mt19937 &rng, double nlos, double miss = 0.0,
+                             const ftm::FloorPlan *plan = nullptr, double loss = 0.0)
+{
+    std::normal_distribution<float> noise(0.0f, 0.15f);
+    std::uniform_real_distribution<float> coin(0.0f, 1.0f), bias(1.0f, 4.0f);
+    std::vector<float> d;
+    for (size_t j = 0; j < site.anchors.size() / 2; ++j) {
+        float ax = site.anchors[2 * j], ay = site.anchors[2 * j + 1];
+        float r = std::hypot(x - ax, y - ay) + noise(rng);
+        if (coin(rng) < miss || (plan && coin(rng) < loss && !plan->segment_free(x, y, ax, ay))) {
+            r = NAN;
+        }
+        d.push_back(coin(rng) < nlos ? r + bias(rng) : r);
+    }
+    return d;
+}
+
+void throughput(const ftm::FloorPlan &plan, const Site &site, size_t n, unsigned threads)
+{
+    ftm::ParticleOptions opt;
+    opt.threads = threads;
+    if (threads == 1) {
+        opt.parallel_min_particles = SIZE_MAX;
+    }
+    ftm::ParticleFilter pf(n, &plan, opt);
+    pf.reset(10, 13.5f, 1.0f);
+    std::mt19937 rng(7);
+    std::vector<float> runs;
+    float x = 10;
+    for (int step = 0; step < 41; ++step) {
+        x += 0.1f;
+        std::vector<float> d = ranges_at(site, x, 13.5f, rng, 0.0);
+        auto start = Clock::now();
+        ftm::ParticleEstimate e = pf.step(0.1f, site.anchors.data(), d.data(), nullptr, d.size());
+        runs.push_back(std::chrono::duration<float, std::micro>(Clock::now() - start).count());
+        sink = e.x;
+    }
+    std::nth_element(runs.begin(), runs.begin() + runs.size() / 2, runs.end());
+    float us = runs[runs.size() / 2];
+    std::printf("  %6zu particles, %2zu thread(s): %9.1f us/fix, %7.1f M particles/s\n", n, pf.threads(), us,
+                n / us);
+}
+
+// A tag walks the corridor past the door of the lower-left room, turns back,
+// goes through the door and walks along the room side of the corridor wall,
+// 0.3 m from it. A quarter of the ranges are NLOS, 30% of the anchors do not
+// answer and 80% of those behind a wall do not either, so many rounds have
+// three or four ranges and an unconstrained cloud drifts across the wall. Compared with the robust
+// multilateration of the same rounds (which holds its last fix when a round
+// has too few ranges), by error, by how many estimates land inside a wall and
+// by how many are on the other side of one.
+void accuracy(const ftm::FloorPlan &plan, const Site &site, size_t n)
+{
+    std::mt19937 rng(11);
+    std::vector<std::pair<float, float>> path;
+    for (float x = 2; x < 24; x += 0.12f) {
+        path.emplace_back(x, 13.5f);
+    }
+    for (float x = 24; x > 19.5f; x -= 0.12f) {
+        path.emplace_back(x, 13.5f);
+    }
+    for (float y = 13.5f; y > 11.5f; y -= 0.12f) {
+        path.emplace_back(19.5f, y);
+    }
+    for (float x = 19.5f; x > 3; x -= 0.12f) {
+        path.emplace_back(x, 11.5f);
+    }
+    std::vector<std::vector<float>> rounds;
+    for (const auto &p : path) {
+        rounds.push_back(ranges_at(site, p.first, p.second, rng, 0.25, 0.3, &plan, 0.8));
+    }
+    const size_t n_anchors = site.anchors.size() / 2;
+
+    auto report = [&](const char *label, auto &&solve) {
+        std::vector<float> errors;
+        size_t in_walls = 0, across = 0;
+        for (size_t k = 0; k < path.size(); ++k) {
+            std::pair<float, float> e = solve(rounds[k]);
+            errors.push_back(std::hypot(e.first - path[k].first, e.second - path[k].second));
+            in_walls += plan.clearance(e.first, e.second) <= 0;
+            across += !plan.segment_free(path[k].first, path[k].second, e.first, e.second);
+        }
+        std::sort(errors.begin(), errors.end());
+        std::printf("  %-28s error p50 %.2f m, p90 %.2f m, %3zu/%zu inside walls, %3zu across a wall\n", label,
+                    errors[errors.size() / 2], errors[errors.size() * 9 / 10], in_walls, errors.size(), across);
+    };
+
+    std::pair<float, float> last = path[0];
+    report("multilateration (Huber)", [&](const std::vector<float> &d) {
+        ftm::Fix<float> fix = ftm::multilaterate(site.anchors.data(), d.data(), static_cast<const float *>(nullptr), n_anchors);
+        if (std::isfinite(fix.x) && std::isfinite(fix.y)) {
+            last = std::make_pair(fix.x, fix.y);
+        }
+        return last;
+    });
+    for (const ftm::FloorPlan *constraint : {static_cast<const ftm::FloorPlan *>(nullptr), &plan}) {
+        ftm::ParticleFilter pf(n, constraint);
+        pf.reset(path[0].first, path[0].second, 0.5f);
+        report(constraint ? "particles, floor plan" : "particles, no floor plan", [&](const std::vector<float> &d) {
+            ftm::ParticleEstimate e = pf.step(0.1f, site.anchors.data(), d.data(), nullptr, d.size());
+            return std::make_pair(e.x, e.y);
+        });
+    }
+}
+
+}  // namespace
+
+int main()
+{
+#if defined(__AVX512F__)
+    std::printf("SIMD: AVX-512\n");
+#elif defined(__AVX2__)
+    std::printf("SIMD: AVX2\n");
+#elif defined(__SSE2__)
+    std::printf("SIMD: SSE2 (build with -DFTM_NATIVE=ON for the local CPU)\n");
+#endif
+    Site site;
+    auto start = Clock::now();
+    ftm::FloorPlan plan(site.grid.data(), Site::width, Site::height, Site::resolution);
+    std::printf("floor plan %zux%zu cells, distance field in %.1f ms\n", plan.width(), plan.height(),
+                std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+
+    std::printf("6 anchors, one round of ranges per fix:\n");
+    for (size_t n : {1000, 10000, 30000, 100000}) {
+        throughput(plan, site, n, 1);
+        if (std::thread::hardware_concurrency() > 1 && n >= ftm::ParticleOptions{}.parallel_min_particles) {
+            throughput(plan, site, n, 0);
+        }
+    }
+
+    std::printf("tag along the corridor, back and into a room along its wall, 25%% NLOS ranges (+1..4 m), "
+                "30%% of anchors missing (80%% behind walls), 5000 particles:\n");
+    accuracy(plan, site, 5000);
+    return 0;
+}
@@ -0,0 +1,62 @@
+#include "ftm_multilat.h"
+#include "ftm_multilat.hpp"
+
+#include <vector>
+
+namespace {
+
+template <typename T, typename Out>
+void copy_fix(const ftm::Fix<T> &fix, Out *out)
+{
+    out->x = fix.x;
+    out->y = fix.y;
+    out->cov_xx = fix.cov_xx;
+    out->cov_xy = fix.cov_xy;
+    out->cov_yy = fix.cov_yy;
+    out->rms = fix.rms;
+    out->rejected = fix.rejected;
+    out->n_anchors = fix.n_anchors;
+    out->iterations = fix.iterations;
+    out->status = static_cast<int32_t>(fix.status);
+}
+
+}  // namespace
+
+extern "C" int ftm_multilat_solve(const double *anchors, const double *distances, const double *variances,
+                                  size_t n_anchors, double *residuals, ftm_fix_t *fix)
+{
+    copy_fix(ftm::multilaterate(anchors, distances, variances, n_anchors, residuals), fix);
+    return fix->status;
+}
+
+extern "C" int ftm_multilat_solve_f(const float *anchors, const float *distances, const float *variances,
+                                    size_t n_anchors, float *residuals, ftm_fixf_t *fix)
+{
+    copy_fix(ftm::multilaterate(anchors, distances, variances, n_anchors, residuals), fix);
+    return fix->status;
+}
+
+extern "C" size_t ftm_multilat_solve_batch(const double *anchors, size_t n_anchors, const double *distances,
+                                           const double *variances, size_t n_tags, double *residuals,
+                                           ftm_fix_t *fixes)
+{
+    std::vector<ftm::Fix<double>> solved(n_tags);
+    size_t ok = ftm::multilaterate_batch(anchors, n_anchors, distances, variances, n_tags, solved.data(), residuals);
+    for (size_t t = 0; t < n_tags; ++t) {
+        copy_fix(solved[t], &fixes[t]);
+    }
+    return ok;
+}
+
+extern "C" size_t ftm_multilat_solve_batch_indexed(const double *anchors, size_t n_anchors, const int32_t *indices,
+                                                   size_t k, const double *distances, const double *variances,
+                                                   size_t n_tags, double *residuals, ftm_fix_t *fixes)
+{
+    std::vector<ftm::Fix<double>> solved(n_tags);
+    size_t ok = ftm::multilaterate_batch_indexed(anchors, n_anchors, indices, k, distances, variances, n_tags,
+                                                 solved.data(), residuals);
+    for (size_t t = 0; t < n_tags; ++t) {
+        copy_fix(solved[t], &fixes[t]);
+    }
+    return ok;
+}
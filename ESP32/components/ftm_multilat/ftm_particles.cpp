@@ -0,0 +1,68 @@
+#include "ftm_particles.h"
+#include "ftm_particles.hpp"
+
+#include <vector>
+
+struct ftm_floor_plan {
+    ftm::FloorPlan plan;
+};
+
+struct ftm_particle_filter {
+    ftm::ParticleFilter filter;
+    // float copies of each round's ranges, reused between steps
+    std::vector<float> anchors, distances, variances;
+};
+
+extern "C" ftm_floor_plan_t *ftm_floor_plan_create(const uint8_t *occupied, size_t width, size_t height,
+                                                   double resolution, double origin_x, double origin_y)
+{
+    return new ftm_floor_plan{ftm::FloorPlan(occupied, width, height, static_cast<float>(resolution),
+                                             static_cast<float>(origin_x), static_cast<float>(origin_y))};
+}
+
+extern "C" void ftm_floor_plan_destroy(ftm_floor_plan_t *plan)
+{
+    delete plan;
+}
+
+extern "C" ftm_particle_filter_t *ftm_pf_create(size_t n_particles, const ftm_floor_plan_t *plan,
+                                                double process_noise, uint32_t seed)
+{
+    ftm::ParticleOptions opt;
+    opt.process_noise = static_cast<float>(process_noise);
+    opt.seed = seed;
+    return new ftm_particle_filter{ftm::ParticleFilter(n_particles, plan ? &plan->plan : nullptr, opt), {}, {}, {}};
+}
+
+extern "C" void ftm_pf_destroy(ftm_particle_filter_t *pf)
+{
+    delete pf;
+}
+
+extern "C" void ftm_pf_reset(ftm_particle_filter_t *pf, double x, double y, double sigma)
+{
+    pf->filter.reset(static_cast<float>(x), static_cast<float>(y), static_cast<float>(sigma));
+}
+
+extern "C" void ftm_pf_step(ftm_particle_filter_t *pf, double dt, const double *anchors, const double *distances,
+                            const double *variances, size_t n, ftm_pf_estimate_t *estimate)
+{
+    pf->anchors.assign(anchors, anchors + 2 * n);
+    pf->distances.assign(distances, distances + n);
+    if (variances) {
+        pf->variances.assign(variances, variances + n);
+    }
+    ftm::ParticleEstimate e = pf->filter.step(static_cast<float>(dt), pf->anchors.data(), pf->distances.data(),
+                                              variances ? pf->variances.data() : nullptr, n);
+    estimate->x = e.x;
+    estimate->y = e.y;
+    estimate->vx = e.vx;
+    estimate->vy = e.vy;
+    estimate->cov_xx = e.cov_xx;
+    estimate->cov_xy = e.cov_xy;
+    estimate->cov_yy = e.cov_yy;
+    estimate->rms = e.rms;
+    estimate->ess = e.ess;
+    estimate->n_ranges = e.n_ranges;
+    estimate->resampled = e.resampled;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* C entry points of ftm_multilat.hpp, for the C firmware and for bindings
+ * (procesamiento_nodos/multilateracion_nativa.py). Anchors are interleaved
+ * x0, y0, x1, y1, ...; a NaN distance marks a missing pair and a NaN or null
+ * variance takes the default. residuals (may be null) receives one range
+ * residual per anchor, NaN where missing. Default options of MultilatOptions:
+ * Huber loss, RANSAC from 5 anchors, batches threaded from 256 tags. */
+
+#define FTM_MULTILAT_OK               0
+#define FTM_MULTILAT_TOO_FEW_ANCHORS  (-1)
+#define FTM_MULTILAT_SINGULAR         (-2)
+
+typedef struct {
+    double x, y;
+    double cov_xx, cov_xy, cov_yy;
+    double rms;
+    uint64_t rejected;      /* bit i: anchor i rejected as an outlier */
+    int32_t n_anchors;      /* anchors used in the fix */
+    int32_t iterations;
+    int32_t status;
+} ftm_fix_t;
+
+typedef struct {
+    float x, y;
+    float cov_xx, cov_xy, cov_yy;
+    float rms;
+    uint64_t rejected;
+    int32_t n_anchors;
+    int32_t iterations;
+    int32_t status;
+} ftm_fixf_t;
+
+/* One tag; returns fix->status */
+int ftm_multilat_solve(const double *anchors, const double *distances, const double *variances,
+                       size_t n_anchors, double *residuals, ftm_fix_t *fix);
+int ftm_multilat_solve_f(const float *anchors, const float *distances, const float *variances,
+                         size_t n_anchors, float *residuals, ftm_fixf_t *fix);
+
+/* n_tags rows of n_anchors distances (and variances and residuals, or null)
+ * against the same anchors; returns how many fixes have status FTM_MULTILAT_OK */
+size_t ftm_multilat_solve_batch(const double *anchors, size_t n_anchors, const double *distances,
+                                const double *variances, size_t n_tags, double *residuals,
+                                ftm_fix_t *fixes);
+
+/* n_tags rows of k anchors each, given by indices (n_tags × k, positions in
+ * anchors, -1 for none), for deployments where every tag only ranges with
+ * nearby anchors. distances, variances and residuals are n_tags × k in the
+ * column order of indices, as are the bits of rejected; k <= 64 */
+size_t ftm_multilat_solve_batch_indexed(const double *anchors, size_t n_anchors, const int32_t *indices,
+                                        size_t k, const double *distances, const double *variances,
+                                        size_t n_tags, double *residuals, ftm_fix_t *fixes);
+
+#ifdef __cplusplus
+}
+#endif
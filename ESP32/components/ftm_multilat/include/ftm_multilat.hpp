@@ -0,0 +1,613 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Multilateration shared by the firmware (float) and the host tools (double).
+// A linear weighted least-squares solve gives a starting point from any number
+// of anchors; with enough anchors RANSAC over 3-anchor subsets replaces it when
+// it explains the ranges better. Levenberg-Marquardt with a robust loss then
+// refines it on the range equations, anchors whose residual stays too large are
+// rejected, and the fix carries the covariance from the remaining ones. Anchors
+// whose distance is not finite are skipped, so callers pass every anchor and
+// mark missing pairs with NaN. Anchor positions are interleaved: x0, y0, x1, ...
+
+namespace ftm {
+
+enum class MultilatLoss : int {
+    squared = 0,
+    huber = 1,
+    tukey = 2,
+};
+
+template <typename T>
+struct MultilatOptions {
+    static_assert(std::is_floating_point<T>::value, "T must be float or double");
+
+    T default_variance = T(0.09);   // m², pairs without a variance estimate
+    T min_variance = T(1e-4);       // m², so no single anchor takes all the weight
+    T max_condition = std::is_same<T, float>::value ? T(1e6) : T(1e10);
+    int max_iterations = 10;
+    T tolerance = T(1e-4);          // m, step length that ends the iterations
+
+    // Residuals are standardised by the standard deviation of each distance,
+    // never below robust_min_sigma so that a tight window does not turn small
+    // model errors (anchor placement, calibration) into outliers.
+    MultilatLoss loss = MultilatLoss::huber;
+    T robust_min_sigma = T(0.15);   // m
+    T huber_k = T(1.345);
+    T tukey_c = T(4.685);
+    T reject_z = T(3);              // standardised residual of a rejected anchor
+
+    size_t ransac_min_anchors = 5;  // 0 disables RANSAC
+    size_t ransac_max_subsets = 220;  // all triples up to 12 anchors, sampled beyond
+
+    // multilaterate_batch splits batches of at least parallel_min_tags tags
+    // over threads (0: one per hardware thread)
+    size_t parallel_min_tags = 256;
+    unsigned threads = 0;
+};
+
+enum class MultilatStatus : int {
+    ok = 0,
+    too_few_anchors = -1,
+    singular = -2,                  // collinear anchors or no convergence
+};
+
+template <typename T>
+struct Fix {
+    T x = NAN;
+    T y = NAN;
+    T cov_xx = NAN;
+    T cov_xy = NAN;
+    T cov_yy = NAN;
+    T rms = NAN;                    // m, range residuals of the anchors used
+    uint64_t rejected = 0;          // bit i: anchor i rejected as an outlier
+    int n_anchors = 0;              // anchors used in the fix
+    int iterations = 0;
+    MultilatStatus status = MultilatStatus::too_few_anchors;
+};
+
+constexpr size_t MULTILAT_MIN_ANCHORS = 3;
+// anchors beyond this index are ignored (anchor sets are bit masks)
+constexpr size_t MULTILAT_MAX_ANCHORS = 64;
+
+namespace detail {
+
+template <typename T>
+inline bool valid_range(T d)
+{
+    return std::isfinite(d) && d >= T(0);
+}
+
+// keeps a parameter out of template argument deduction, so nullptr can be passed
+template <typename T>
+struct identity {
+    using type = T;
+};
+
+inline int count_bits(uint64_t mask)
+{
+    int bits = 0;
+    for (; mask; mask &= mask - 1) {
+        ++bits;
+    }
+    return bits;
+}
+
+template <typename T>
+inline T clamp_variance(const T *variances, size_t i, const MultilatOptions<T> &opt)
+{
+    T v = variances && std::isfinite(variances[i]) ? variances[i] : opt.default_variance;
+    return std::max(v, opt.min_variance);
+}
+
+// IRLS weight ψ(z)/z and loss ρ(z) of a standardised residual
+template <typename T>
+inline T robust_weight(T z, const MultilatOptions<T> &opt)
+{
+    const T a = std::fabs(z);
+    switch (opt.loss) {
+    case MultilatLoss::huber:
+        return a <= opt.huber_k ? T(1) : opt.huber_k / a;
+    case MultilatLoss::tukey: {
+        if (a >= opt.tukey_c) {
+            return T(0);
+        }
+        const T u = T(1) - (z / opt.tukey_c) * (z / opt.tukey_c);
+        return u * u;
+    }
+    default:
+        return T(1);
+    }
+}
+
+template <typename T>
+inline T robust_loss(T z, const MultilatOptions<T> &opt)
+{
+    const T a = std::fabs(z);
+    switch (opt.loss) {
+    case MultilatLoss::huber:
+        return a <= opt.huber_k ? z * z / T(2) : opt.huber_k * (a - opt.huber_k / T(2));
+    case MultilatLoss::tukey: {
+        const T c2 = opt.tukey_c * opt.tukey_c / T(6);
+        if (a >= opt.tukey_c) {
+            return c2;
+        }
+        const T u = T(1) - (z / opt.tukey_c) * (z / opt.tukey_c);
+        return c2 * (T(1) - u * u * u);
+    }
+    default:
+        return z * z / T(2);
+    }
+}
+
+// Symmetric 3x3 matrix stored as a00 a01 a02 a11 a12 a22. Inverse by cofactors,
+// false when singular or beyond max_condition (Frobenius norm).
+template <typename T>
+inline bool invert_sym3(const T m[6], T inv[6], T max_condition)
+{
+    const T c00 = m[3] * m[5] - m[4] * m[4];
+    const T c01 = m[2] * m[4] - m[1] * m[5];
+    const T c02 = m[1] * m[4] - m[2] * m[3];
+    const T c11 = m[0] * m[5] - m[2] * m[2];
+    const T c12 = m[1] * m[2] - m[0] * m[4];
+    const T c22 = m[0] * m[3] - m[1] * m[1];
+    const T det = m[0] * c00 + m[1] * c01 + m[2] * c02;
+    if (!(det != T(0)) || !std::isfinite(det)) {
+        return false;
+    }
+    const T k = T(1) / det;
+    inv[0] = c00 * k; inv[1] = c01 * k; inv[2] = c02 * k;
+    inv[3] = c11 * k; inv[4] = c12 * k; inv[5] = c22 * k;
+
+    auto norm2 = [](const T a[6]) {
+        return a[0] * a[0] + a[3] * a[3] + a[5] * a[5] + T(2) * (a[1] * a[1] + a[2] * a[2] + a[4] * a[4]);
+    };
+    return norm2(m) * norm2(inv) < max_condition * max_condition;
+}
+
+// Symmetric 2x2 matrix stored as a00 a01 a11
+template <typename T>
+inline bool invert_sym2(const T m[3], T inv[3], T max_condition)
+{
+    const T det = m[0] * m[2] - m[1] * m[1];
+    if (!(det != T(0)) || !std::isfinite(det)) {
+        return false;
+    }
+    const T k = T(1) / det;
+    inv[0] = m[2] * k; inv[1] = -m[1] * k; inv[2] = m[0] * k;
+
+    auto norm2 = [](const T a[3]) { return a[0] * a[0] + T(2) * a[1] * a[1] + a[2] * a[2]; };
+    return norm2(m) * norm2(inv) < max_condition * max_condition;
+}
+
+// One tag: the anchors, its ranges and the frame positions are solved in,
+// centred on the valid anchors. N > 0 fixes the anchor count at compile time
+// so the loops unroll.
+template <typename T, size_t N>
+struct Problem {
+    const T *anchors;
+    const T *distances;
+    const T *variances;
+    size_t count;
+    const MultilatOptions<T> &opt;
+    T cx = 0, cy = 0;
+    T spread = 0;
+
+    size_t size() const { return N ? N : count; }
+    T ax(size_t i) const { return anchors[2 * i] - cx; }
+    T ay(size_t i) const { return anchors[2 * i + 1] - cy; }
+    T sigma(size_t i) const { return std::max(std::sqrt(clamp_variance(variances, i, opt)), opt.robust_min_sigma); }
+
+    // Linear step on the anchors of use: 2·xi·x + 2·yi·y - R = xi² + yi² - di²
+    // with R = x² + y², weighted by 1 / var(di²) = 1 / (4·di²·var(di)). It works
+    // in units of the anchor spread so the x, y and R columns have similar
+    // magnitudes.
+    bool linear(uint64_t use, T &px, T &py) const
+    {
+        const T unit = T(1) / spread;
+        T m[6] = {}, rhs[3] = {};
+        for (size_t i = 0; i < size(); ++i) {
+            if (!(use >> i & 1)) {
+                continue;
+            }
+            const T d = distances[i] * unit;
+            const T ux = ax(i) * unit, uy = ay(i) * unit;
+            const T w = T(1) / (T(4) * std::max(distances[i] * distances[i], opt.min_variance) *
+                                clamp_variance(variances, i, opt));
+            const T a0 = T(2) * ux, a1 = T(2) * uy;
+            const T b = ux * ux + uy * uy - d * d;
+            m[0] += w * a0 * a0; m[1] += w * a0 * a1; m[2] -= w * a0;
+            m[3] += w * a1 * a1; m[4] -= w * a1;      m[5] += w;
+            rhs[0] += w * a0 * b; rhs[1] += w * a1 * b; rhs[2] -= w * b;
+        }
+        T inv[6];
+        if (!invert_sym3(m, inv, opt.max_condition)) {
+            return false;
+        }
+        px = (inv[0] * rhs[0] + inv[1] * rhs[1] + inv[2] * rhs[2]) * spread;
+        py = (inv[1] * rhs[0] + inv[3] * rhs[1] + inv[4] * rhs[2]) * spread;
+        return std::isfinite(px) && std::isfinite(py);
+    }
+
+    T residual(size_t i, T px, T py) const
+    {
+        const T dx = px - ax(i), dy = py - ay(i);
+        return std::sqrt(dx * dx + dy * dy) - distances[i];
+    }
+
+    // MSAC score: squared standardised residuals truncated at reject_z
+    T score(uint64_t use, T px, T py) const
+    {
+        const T cap = opt.reject_z * opt.reject_z;
+        T total = 0;
+        for (size_t i = 0; i < size(); ++i) {
+            if (use >> i & 1) {
+                const T z = residual(i, px, py) / sigma(i);
+                total += std::min(z * z, cap);
+            }
+        }
+        return total;
+    }
+
+    struct Normals {
+        T h[3] = {};                // JᵀWJ: a00 a01 a11
+        T g[2] = {};                // JᵀWr
+        T cost = 0;                 // Σ (s²/v)·ρ(r/s)
+        T sum_sq = 0;               // Σ r²
+    };
+
+    // robust: IRLS weights of the loss; otherwise 1 / var (covariance)
+    Normals normals(uint64_t use, T px, T py, bool robust) const
+    {
+        Normals out;
+        for (size_t i = 0; i < size(); ++i) {
+            if (!(use >> i & 1)) {
+                continue;
+            }
+            const T dx = px - ax(i), dy = py - ay(i);
+            const T r = std::sqrt(dx * dx + dy * dy);
+            const T res = r - distances[i];
+            const T v = clamp_variance(variances, i, opt);
+            const T s = sigma(i);
+            const T z = res / s;
+            out.sum_sq += res * res;
+            out.cost += robust ? s * s / v * robust_loss(z, opt) : res * res / (T(2) * v);
+            if (!(r > T(0))) {
+                continue;
+            }
+            const T w = (robust ? robust_weight(z, opt) : T(1)) / v;
+            const T jx = dx / r, jy = dy / r;
+            out.h[0] += w * jx * jx; out.h[1] += w * jx * jy; out.h[2] += w * jy * jy;
+            out.g[0] += w * jx * res; out.g[1] += w * jy * res;
+        }
+        return out;
+    }
+
+    void ransac(uint64_t valid, T &px, T &py) const
+    {
+        size_t idx[MULTILAT_MAX_ANCHORS];
+        size_t m = 0;
+        for (size_t i = 0; i < size(); ++i) {
+            if (valid >> i & 1) {
+                idx[m++] = i;
+            }
+        }
+
+        T best = score(valid, px, py);
+        if (!std::isfinite(best)) {
+            best = T(INFINITY);
+        }
+        auto consider = [&](size_t a, size_t b, size_t c) {
+            T qx, qy;
+            if (linear(uint64_t(1) << a | uint64_t(1) << b | uint64_t(1) << c, qx, qy)) {
+                T s = score(valid, qx, qy);
+                if (s < best) {
+                    best = s;
+                    px = qx;
+                    py = qy;
+                }
+            }
+        };
+
+        const size_t triples = m * (m - 1) * (m - 2) / 6;
+        if (triples <= opt.ransac_max_subsets) {
+            for (size_t a = 0; a < m; ++a) {
+                for (size_t b = a + 1; b < m; ++b) {
+                    for (size_t c = b + 1; c < m; ++c) {
+                        consider(idx[a], idx[b], idx[c]);
+                    }
+                }
+            }
+            return;
+        }
+        // fixed seed: the same ranges always give the same fix
+        uint64_t state = 0x9E3779B97F4A7C15ull ^ valid;
+        auto next = [&state](size_t bound) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<size_t>(state % bound);
+        };
+        for (size_t k = 0; k < opt.ransac_max_subsets; ++k) {
+            size_t a = next(m), b = next(m - 1), c = next(m - 2);
+            b += b >= a;
+            c += c >= std::min(a, b);
+            c += c >= std::max(a, b);
+            consider(idx[a], idx[b], idx[c]);
+        }
+    }
+
+    // Levenberg-Marquardt on the robust cost; false if it cannot move at all
+    bool refine(uint64_t valid, T &px, T &py, int &iterations) const
+    {
+        T lambda = T(1e-3);
+        Normals cur = normals(valid, px, py, true);
+        for (int it = 0; it < opt.max_iterations; ++it) {
+            const T damped[3] = {cur.h[0] * (T(1) + lambda), cur.h[1], cur.h[2] * (T(1) + lambda)};
+            T inv[3];
+            if (!invert_sym2(damped, inv, opt.max_condition)) {
+                return it > 0;
+            }
+            const T sx = -(inv[0] * cur.g[0] + inv[1] * cur.g[1]);
+            const T sy = -(inv[1] * cur.g[0] + inv[2] * cur.g[1]);
+            iterations = it + 1;
+            Normals next = normals(valid, px + sx, py + sy, true);
+            if (std::isfinite(next.cost) && next.cost <= cur.cost) {
+                px += sx;
+                py += sy;
+                cur = next;
+                lambda = std::max(lambda * T(0.1), T(1e-7));
+                if (sx * sx + sy * sy < opt.tolerance * opt.tolerance) {
+                    break;
+                }
+            } else {
+                lambda *= T(10);
+                if (lambda > T(1e7)) {
+                    break;
+                }
+            }
+        }
+        return std::isfinite(px) && std::isfinite(py);
+    }
+
+    // anchors whose standardised residual exceeds reject_z
+    uint64_t outliers(uint64_t use, T px, T py) const
+    {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < size(); ++i) {
+            if ((use >> i & 1) && std::fabs(residual(i, px, py)) / sigma(i) > opt.reject_z) {
+                mask |= uint64_t(1) << i;
+            }
+        }
+        return mask;
+    }
+};
+
+template <typename T, size_t N>
+Fix<T> multilaterate(const T *anchors, const T *distances, const T *variances, size_t n,
+                     T *residuals, const MultilatOptions<T> &opt)
+{
+    const size_t count = std::min(N ? N : n, MULTILAT_MAX_ANCHORS);
+    Problem<T, N> p{anchors, distances, variances, count, opt};
+    Fix<T> fix;
+    if (residuals) {
+        std::fill(residuals, residuals + (N ? N : n), T(NAN));
+    }
+
+    uint64_t valid = 0;
+    int n_valid = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (valid_range(distances[i])) {
+            valid |= uint64_t(1) << i;
+            p.cx += anchors[2 * i];
+            p.cy += anchors[2 * i + 1];
+            ++n_valid;
+        }
+    }
+    fix.n_anchors = n_valid;
+    if (static_cast<size_t>(n_valid) < MULTILAT_MIN_ANCHORS) {
+        return fix;
+    }
+    p.cx /= n_valid;
+    p.cy /= n_valid;
+    fix.status = MultilatStatus::singular;
+
+    for (size_t i = 0; i < count; ++i) {
+        if (valid >> i & 1) {
+            p.spread += p.ax(i) * p.ax(i) + p.ay(i) * p.ay(i);
+        }
+    }
+    p.spread = std::sqrt(p.spread / n_valid);
+    if (!(p.spread > T(0))) {
+        return fix;
+    }
+
+    T px, py;
+    if (!p.linear(valid, px, py)) {
+        return fix;
+    }
+    bool refined = p.refine(valid, px, py, fix.iterations);
+
+    // RANSAC only when the robust fit still leaves outliers: a bad linear start
+    // can make LM settle next to the outlier instead of rejecting it
+    if (opt.ransac_min_anchors && static_cast<size_t>(n_valid) >= opt.ransac_min_anchors &&
+        (!refined || p.outliers(valid, px, py))) {
+        T qx = px, qy = py;
+        int iterations = 0;
+        p.ransac(valid, qx, qy);
+        if (p.refine(valid, qx, qy, iterations) &&
+            (!refined || p.normals(valid, qx, qy, true).cost < p.normals(valid, px, py, true).cost)) {
+            px = qx;
+            py = qy;
+            refined = true;
+        }
+        fix.iterations += iterations;
+    }
+    if (!refined) {
+        return fix;
+    }
+
+    // rejection, as long as enough anchors remain to fix the position
+    uint64_t rejected = p.outliers(valid, px, py);
+    if (static_cast<size_t>(count_bits(valid & ~rejected)) < MULTILAT_MIN_ANCHORS) {
+        rejected = 0;
+    }
+    const uint64_t used = valid & ~rejected;
+
+    const auto at_fix = p.normals(used, px, py, false);
+    T inv[3];
+    if (!invert_sym2(at_fix.h, inv, opt.max_condition)) {
+        return fix;
+    }
+    if (residuals) {
+        for (size_t i = 0; i < count; ++i) {
+            if (valid >> i & 1) {
+                residuals[i] = p.residual(i, px, py);
+            }
+        }
+    }
+
+    fix.x = px + p.cx;
+    fix.y = py + p.cy;
+    fix.cov_xx = inv[0];
+    fix.cov_xy = inv[1];
+    fix.cov_yy = inv[2];
+    fix.n_anchors = count_bits(used);
+    fix.rms = std::sqrt(at_fix.sum_sq / fix.n_anchors);
+    fix.rejected = rejected;
+    fix.status = MultilatStatus::ok;
+    return fix;
+}
+
+template <typename T>
+Fix<T> dispatch(const T *anchors, const T *distances, const T *variances, size_t n, T *residuals,
+                const MultilatOptions<T> &opt)
+{
+    switch (n) {
+    case 3: return multilaterate<T, 3>(anchors, distances, variances, n, residuals, opt);
+    case 4: return multilaterate<T, 4>(anchors, distances, variances, n, residuals, opt);
+    case 5: return multilaterate<T, 5>(anchors, distances, variances, n, residuals, opt);
+    case 6: return multilaterate<T, 6>(anchors, distances, variances, n, residuals, opt);
+    case 8: return multilaterate<T, 8>(anchors, distances, variances, n, residuals, opt);
+    default: return multilaterate<T, 0>(anchors, distances, variances, n, residuals, opt);
+    }
+}
+
+}  // namespace detail
+
+// One tag from n anchors. variances may be null (default_variance for all);
+// residuals, if not null, receives the n range residuals (NaN where missing).
+template <typename T>
+Fix<T> multilaterate(const T *anchors, const T *distances, const T *variances, size_t n,
+                     typename detail::identity<T>::type *residuals = nullptr,
+                     const MultilatOptions<T> &opt = {})
+{
+    return detail::dispatch(anchors, distances, variances, n, residuals, opt);
+}
+
+// Fixed anchor count known at compile time
+template <size_t N, typename T>
+Fix<T> multilaterate(const std::array<T, 2 * N> &anchors, const std::array<T, N> &distances,
+                     const std::array<T, N> &variances, std::array<T, N> *residuals = nullptr,
+                     const MultilatOptions<T> &opt = {})
+{
+    return detail::multilaterate<T, N>(anchors.data(), distances.data(), variances.data(), N,
+                                       residuals ? residuals->data() : nullptr, opt);
+}
+
+namespace detail {
+
+// Runs solve(first, last) over [0, n_tags), split over threads for large batches;
+// returns the sum of what the calls return
+template <typename T, typename Solve>
+size_t parallel_tags(size_t n_tags, const MultilatOptions<T> &opt, Solve &&solve)
+{
+    size_t threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, n_tags / std::max<size_t>(opt.parallel_min_tags / 4, 1));
+    if (threads < 2 || n_tags < opt.parallel_min_tags) {
+        return solve(0, n_tags);
+    }
+
+    const size_t chunk = (n_tags + threads - 1) / threads;
+    std::vector<size_t> solved(threads, 0);
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < threads; ++k) {
+        workers.emplace_back([&, k] {
+            solved[k] = solve(std::min(n_tags, k * chunk), std::min(n_tags, (k + 1) * chunk));
+        });
+    }
+    solved[0] = solve(0, std::min(n_tags, chunk));
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+    size_t total = 0;
+    for (size_t s : solved) {
+        total += s;
+    }
+    return total;
+}
+
+}  // namespace detail
+
+// Every tag against the same anchors. distances, variances and residuals are
+// row-major n_tags × n_anchors (variances and residuals may be null). Large
+// batches are split over threads. Returns the number of fixes with status ok.
+template <typename T>
+size_t multilaterate_batch(const T *anchors, size_t n_anchors, const T *distances, const T *variances,
+                           size_t n_tags, Fix<T> *fixes,
+                           typename detail::identity<T>::type *residuals = nullptr,
+                           const MultilatOptions<T> &opt = {})
+{
+    return detail::parallel_tags(n_tags, opt, [&](size_t first, size_t last) {
+        size_t solved = 0;
+        for (size_t t = first; t < last; ++t) {
+            fixes[t] = detail::dispatch(anchors, distances + t * n_anchors,
+                                        variances ? variances + t * n_anchors : nullptr, n_anchors,
+                                        residuals ? residuals + t * n_anchors : nullptr, opt);
+            solved += fixes[t].status == MultilatStatus::ok;
+        }
+        return solved;
+    });
+}
+
+// Every tag against its own k anchors out of a large deployment: row t of
+// indices (n_tags × k) holds the anchors of tag t as positions in anchors, -1
+// where the row has fewer than k. distances, variances and residuals are
+// n_tags × k in the same column order, and bit i of fixes[t].rejected refers to
+// column i. k is at most MULTILAT_MAX_ANCHORS.
+template <typename T>
+size_t multilaterate_batch_indexed(const T *anchors, size_t n_anchors, const int32_t *indices, size_t k,
+                                   const T *distances, const T *variances, size_t n_tags, Fix<T> *fixes,
+                                   typename detail::identity<T>::type *residuals = nullptr,
+                                   const MultilatOptions<T> &opt = {})
+{
+    k = std::min(k, MULTILAT_MAX_ANCHORS);
+    return detail::parallel_tags(n_tags, opt, [&](size_t first, size_t last) {
+        T local[2 * MULTILAT_MAX_ANCHORS];
+        T ranges[MULTILAT_MAX_ANCHORS];
+        size_t solved = 0;
+        for (size_t t = first; t < last; ++t) {
+            for (size_t j = 0; j < k; ++j) {
+                const int32_t a = indices[t * k + j];
+                const bool known = a >= 0 && static_cast<size_t>(a) < n_anchors;
+                local[2 * j] = known ? anchors[2 * a] : T(0);
+                local[2 * j + 1] = known ? anchors[2 * a + 1] : T(0);
+                ranges[j] = known ? distances[t * k + j] : T(NAN);
+            }
+            fixes[t] = detail::dispatch(local, ranges, variances ? variances + t * k : nullptr, k,
+                                        residuals ? residuals + t * k : nullptr, opt);
+            solved += fixes[t].status == MultilatStatus::ok;
+        }
+        return solved;
+    });
+}
+
+}  // namespace ftm
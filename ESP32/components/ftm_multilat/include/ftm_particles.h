@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* C entry points of ftm_particles.hpp, for bindings
+ * (procesamiento_nodos/multilateracion_nativa.py). The occupancy grid is
+ * row-major from the lower-left cell, non-zero for walls; a filter keeps a
+ * pointer to its plan, which must outlive it. Anchors are interleaved
+ * x0, y0, x1, y1, ...; a NaN distance is skipped and a NaN or null variance
+ * takes the default. */
+
+typedef struct ftm_floor_plan ftm_floor_plan_t;
+typedef struct ftm_particle_filter ftm_particle_filter_t;
+
+typedef struct {
+    double x, y, vx, vy;
+    double cov_xx, cov_xy, cov_yy;
+    double rms;             /* residual RMS at (x, y) of the non-outlier ranges, NaN if none */
+    double ess;             /* effective sample size after weighting */
+    int32_t n_ranges;
+    int32_t resampled;
+} ftm_pf_estimate_t;
+
+ftm_floor_plan_t *ftm_floor_plan_create(const uint8_t *occupied, size_t width, size_t height,
+                                        double resolution, double origin_x, double origin_y);
+void ftm_floor_plan_destroy(ftm_floor_plan_t *plan);
+
+/* plan may be null; process_noise is the acceleration spectral density (m²/s³) */
+ftm_particle_filter_t *ftm_pf_create(size_t n_particles, const ftm_floor_plan_t *plan, double process_noise,
+                                     uint32_t seed);
+void ftm_pf_destroy(ftm_particle_filter_t *pf);
+
+void ftm_pf_reset(ftm_particle_filter_t *pf, double x, double y, double sigma);
+
+/* predicts dt seconds, weights with n ranges and estimates */
+void ftm_pf_step(ftm_particle_filter_t *pf, double dt, const double *anchors, const double *distances,
+                 const double *variances, size_t n, ftm_pf_estimate_t *estimate);
+
+#ifdef __cplusplus
+}
+#endif
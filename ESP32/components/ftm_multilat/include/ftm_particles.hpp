@@ -0,0 +1,538 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Particle filter on raw ranges constrained by a rasterised floor plan, for
+// sites with walls and corridors where a least-squares fix (ftm_multilat.hpp)
+// can land inside a wall. Each particle carries a position and a velocity.
+// Propagation is constant velocity with random acceleration, and a particle
+// whose step would cross a wall stays where it was and stops. Ranges weight the
+// particles with a Gaussian truncated at the same outlier threshold as the
+// robust multilateration, so one NLOS range cannot wipe out the cloud.
+// Systematic resampling runs when the effective sample size drops. Particles
+// are kept as float arrays so the propagation and weighting loops vectorise
+// (the sqrt in the weighting needs -fno-math-errno), every buffer is allocated
+// up front, and large filters split each pass over threads. Anchor positions
+// are interleaved: x0, y0, x1, ...
+
+namespace ftm {
+
+namespace detail {
+
+// 1-D squared distance transform of n samples of f with the given stride
+// (Felzenszwalb and Huttenlocher, lower envelope of parabolas)
+inline void squared_distance_1d(double *f, size_t n, size_t stride, std::vector<double> &d,
+                                std::vector<size_t> &v, std::vector<double> &z)
+{
+    const double inf = HUGE_VAL;
+    auto intersection = [&](size_t q, size_t p) {
+        return ((f[q * stride] + double(q) * q) - (f[p * stride] + double(p) * p)) / (2.0 * q - 2.0 * p);
+    };
+    size_t k = 0;
+    v[0] = 0;
+    z[0] = -inf;
+    z[1] = inf;
+    for (size_t q = 1; q < n; ++q) {
+        double s = intersection(q, v[k]);
+        while (s <= z[k]) {
+            --k;
+            s = intersection(q, v[k]);
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = inf;
+    }
+    k = 0;
+    for (size_t q = 0; q < n; ++q) {
+        while (z[k + 1] < q) {
+            ++k;
+        }
+        double dq = double(q) - double(v[k]);
+        d[q] = dq * dq + f[v[k] * stride];
+    }
+    for (size_t q = 0; q < n; ++q) {
+        f[q * stride] = d[q];
+    }
+}
+
+// counter-based generator: every particle draws from its own key, so the
+// propagation loop has no shared state and vectorises
+inline uint32_t hash32(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7feb352du;
+    x ^= x >> 15;
+    x *= 0x846ca68bu;
+    x ^= x >> 16;
+    return x;
+}
+
+inline float uniform(uint32_t key)
+{
+    return float(hash32(key) >> 8) * (1.0f / 16777216.0f);
+}
+
+// approximately standard normal: sum of four uniforms, centred and scaled
+inline float normal(uint32_t key)
+{
+    float s = uniform(key) + uniform(key ^ 0x9e3779b9u) + uniform(key ^ 0x3c6ef372u) + uniform(key ^ 0xdaa66d2bu);
+    return (s - 2.0f) * 1.7320508f;
+}
+
+// e^x for x <= 0 to about 4e-6 relative, 0 below about -87: 2^(x·log2 e)
+// split into an integer power, written straight into the exponent bits, and a
+// polynomial for the fraction. Unlike std::exp it vectorises without
+// -ffast-math; the clamp is on the integer so it does not need -fno-trapping-math.
+inline float exp_nonpositive(float x)
+{
+    float t = x * 1.44269504f;
+    int32_t n = int32_t(t + 128.0f) - 128;  // floor for t > -128
+    float f = t - float(n);
+    float p = 1.87757667e-3f;
+    p = p * f + 8.98934009e-3f;
+    p = p * f + 5.58263180e-2f;
+    p = p * f + 2.40153617e-1f;
+    p = p * f + 6.93153073e-1f;
+    p = p * f + 9.99999994e-1f;
+    int32_t bits = (std::max(n, int32_t(-127)) + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof scale);
+    return p * scale;
+}
+
+// constant velocity with white acceleration: velocity noise of standard
+// deviation sv over the step. Separate restrict arrays so the loop vectorises.
+inline void propagate(const float *__restrict x, const float *__restrict y, const float *__restrict vx,
+                      const float *__restrict vy, float *__restrict nx, float *__restrict ny,
+                      float *__restrict nvx, float *__restrict nvy, size_t first, size_t last, float sv,
+                      float half_dt, uint32_t base)
+{
+    for (size_t i = first; i < last; ++i) {
+        float ax = sv * normal(base + uint32_t(2 * i));
+        float ay = sv * normal(base + uint32_t(2 * i + 1));
+        nvx[i] = vx[i] + ax;
+        nvy[i] = vy[i] + ay;
+        nx[i] = x[i] + (2.0f * vx[i] + ax) * half_dt;
+        ny[i] = y[i] + (2.0f * vy[i] + ay) * half_dt;
+    }
+}
+
+// adds the truncated Gaussian log-likelihood of one range to every particle
+inline void weight_range(const float *__restrict x, const float *__restrict y, float *__restrict lw, size_t first,
+                         size_t last, float ax, float ay, float d, float inv_sigma, float z2)
+{
+    for (size_t i = first; i < last; ++i) {
+        float dx = x[i] - ax, dy = y[i] - ay;
+        float e = (std::sqrt(dx * dx + dy * dy) - d) * inv_sigma;
+        lw[i] -= 0.5f * std::min(e * e, z2);
+    }
+}
+
+// shifts the log-weights so the largest is 0 and writes the weights
+inline void normalise(float *__restrict lw, float *__restrict w, size_t first, size_t last, float max_lw)
+{
+    for (size_t i = first; i < last; ++i) {
+        lw[i] -= max_lw;
+        w[i] = exp_nonpositive(lw[i]);
+    }
+}
+
+// weighted sums of a chunk, and its running sum of weights for resampling
+struct Moments {
+    double w, w2, x, y, vx, vy, xx, xy, yy;
+};
+
+inline Moments moments(const float *__restrict w, const float *__restrict x, const float *__restrict y,
+                       const float *__restrict vx, const float *__restrict vy, double *__restrict cdf,
+                       size_t first, size_t last)
+{
+    double sw = 0, sw2 = 0, sx = 0, sy = 0, svx = 0, svy = 0, sxx = 0, sxy = 0, syy = 0;
+    for (size_t i = first; i < last; ++i) {
+        double wi = w[i];
+        sw += wi;
+        cdf[i] = sw;
+        sw2 += wi * wi;
+        sx += wi * x[i];
+        sy += wi * y[i];
+        svx += wi * vx[i];
+        svy += wi * vy[i];
+        sxx += wi * x[i] * x[i];
+        sxy += wi * x[i] * y[i];
+        syy += wi * y[i] * y[i];
+    }
+    return Moments{sw, sw2, sx, sy, svx, svy, sxx, sxy, syy};
+}
+
+// runs f(k, first, last) over n items split in `threads` contiguous chunks
+template <typename F>
+void parallel_chunks(size_t n, size_t threads, F &&f)
+{
+    if (threads < 2) {
+        f(size_t(0), size_t(0), n);
+        return;
+    }
+    const size_t chunk = (n + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < threads; ++k) {
+        workers.emplace_back([&f, k, chunk, n] { f(k, std::min(n, k * chunk), std::min(n, (k + 1) * chunk)); });
+    }
+    f(size_t(0), size_t(0), std::min(n, chunk));
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+}
+
+}  // namespace detail
+
+// Occupancy grid and its distance field. Cell (0, 0) is the one at the origin
+// (lower-left corner) and rows grow along y; a non-zero cell is a wall.
+class FloorPlan {
+public:
+    FloorPlan(const uint8_t *occupied, size_t width, size_t height, float resolution, float origin_x = 0,
+              float origin_y = 0)
+        : width_(width), height_(height), resolution_(resolution), inv_resolution_(1.0f / resolution),
+          origin_x_(origin_x), origin_y_(origin_y), distance_(width * height)
+    {
+        // exact Euclidean distance transform, columns then rows, in cells²
+        std::vector<double> f(width * height);
+        for (size_t i = 0; i < f.size(); ++i) {
+            f[i] = occupied[i] ? 0.0 : 1e20;
+        }
+        size_t longest = std::max(width, height);
+        std::vector<double> d(longest), z(longest + 1);
+        std::vector<size_t> v(longest);
+        for (size_t x = 0; x < width; ++x) {
+            detail::squared_distance_1d(&f[x], height, width, d, v, z);
+        }
+        for (size_t y = 0; y < height; ++y) {
+            detail::squared_distance_1d(&f[y * width], width, 1, d, v, z);
+        }
+        // metres from the cell centre to the edge of the nearest wall cell
+        for (size_t i = 0; i < f.size(); ++i) {
+            distance_[i] = occupied[i] ? 0.0f : std::max(float(std::sqrt(f[i]) - 0.5) * resolution, 0.0f);
+        }
+    }
+
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+    float resolution() const { return resolution_; }
+
+    // metres to the nearest wall; 0 inside walls and outside the plan
+    float clearance(float x, float y) const
+    {
+        float cx = (x - origin_x_) * inv_resolution_;
+        float cy = (y - origin_y_) * inv_resolution_;
+        if (!(cx >= 0 && cy >= 0 && cx < float(width_) && cy < float(height_))) {
+            return 0;
+        }
+        return distance_[size_t(cy) * width_ + size_t(cx)];
+    }
+
+    // Whether the segment between two points stays in free space. The distance
+    // field lets it advance by the clearance instead of cell by cell, less half
+    // a cell for where the point sits inside its cell.
+    bool segment_free(float x0, float y0, float x1, float y1) const
+    {
+        float dx = x1 - x0, dy = y1 - y0;
+        float length = std::sqrt(dx * dx + dy * dy);
+        float t = 0;
+        for (;;) {
+            float f = length > 0 ? t / length : 0;
+            float c = clearance(x0 + f * dx, y0 + f * dy);
+            if (c <= 0) {
+                return false;
+            }
+            t += std::max(c - 0.5f * resolution_, 0.5f * resolution_);
+            if (t >= length) {
+                return clearance(x1, y1) > 0;
+            }
+        }
+    }
+
+private:
+    size_t width_, height_;
+    float resolution_, inv_resolution_;
+    float origin_x_, origin_y_;
+    std::vector<float> distance_;
+};
+
+struct ParticleOptions {
+    float process_noise = 0.5f;         // m²/s³, acceleration spectral density
+    float default_variance = 0.09f;     // m², ranges without a variance estimate
+    float min_sigma = 0.15f;            // m, as MultilatOptions::robust_min_sigma
+    float outlier_z = 3.0f;             // standardised residual where a range stops counting
+    float resample_threshold = 0.5f;    // effective sample size, fraction of the particles
+    size_t parallel_min_particles = 16384;
+    unsigned threads = 0;               // 0: one per hardware thread
+    uint32_t seed = 1;
+};
+
+struct ParticleEstimate {
+    float x, y, vx, vy;
+    float cov_xx, cov_xy, cov_yy;
+    float rms;          // m, residual RMS at (x, y) of the ranges within outlier_z
+    float ess;          // effective sample size after weighting
+    int n_ranges;       // ranges with a finite distance
+    bool resampled;
+};
+
+class ParticleFilter {
+public:
+    // plan may be null (no walls); it must outlive the filter
+    explicit ParticleFilter(size_t n_particles, const FloorPlan *plan = nullptr, const ParticleOptions &opt = {})
+        : plan_(plan), opt_(opt), n_(n_particles), x_(n_), y_(n_), vx_(n_), vy_(n_), lw_(n_), nx_(n_), ny_(n_),
+          nvx_(n_), nvy_(n_), w_(n_), cdf_(n_)
+    {
+        size_t threads = opt.threads ? opt.threads : std::max(1u, std::thread::hardware_concurrency());
+        if (n_ >= opt.parallel_min_particles) {
+            threads_ = std::max<size_t>(std::min(threads, n_ / std::max<size_t>(opt.parallel_min_particles / 4, 1)), 1);
+        }
+        partial_.resize(threads_);
+    }
+
+    size_t size() const { return n_; }
+    size_t threads() const { return threads_; }
+
+    // particles spread around (x, y) with standard deviation sigma, at rest;
+    // draws that land in a wall are retried further out
+    void reset(float x, float y, float sigma)
+    {
+        uint32_t base = detail::hash32(opt_.seed ^ (++counter_ * 0x9e3779b9u));
+        for (size_t i = 0; i < n_; ++i) {
+            x_[i] = x;
+            y_[i] = y;
+            for (uint32_t attempt = 0; attempt < 32; ++attempt) {
+                uint32_t key = base + uint32_t(4 * i) + attempt * 0x632be5abu;
+                float spread = sigma * (1.0f + 0.25f * attempt);
+                float px = x + spread * detail::normal(key), py = y + spread * detail::normal(key + 1);
+                if (!plan_ || plan_->clearance(px, py) > 0) {
+                    x_[i] = px;
+                    y_[i] = py;
+                    break;
+                }
+            }
+            vx_[i] = vy_[i] = lw_[i] = 0;
+        }
+    }
+
+    // constant velocity with white acceleration over dt seconds
+    void predict(float dt)
+    {
+        if (!(dt > 0)) {
+            return;
+        }
+        const float sv = std::sqrt(opt_.process_noise * dt);
+        const float half_dt = 0.5f * dt;
+        const uint32_t base = detail::hash32(opt_.seed ^ (++counter_ * 0x9e3779b9u));
+        detail::parallel_chunks(n_, threads_, [&](size_t, size_t first, size_t last) {
+            detail::propagate(x_.data(), y_.data(), vx_.data(), vy_.data(), nx_.data(), ny_.data(), nvx_.data(),
+                              nvy_.data(), first, last, sv, half_dt, base);
+            if (!plan_) {
+                return;
+            }
+            // a step shorter than the clearance cannot reach a wall
+            for (size_t i = first; i < last; ++i) {
+                float dx = nx_[i] - x_[i], dy = ny_[i] - y_[i];
+                float c = plan_->clearance(x_[i], y_[i]);
+                if (dx * dx + dy * dy < c * c || plan_->segment_free(x_[i], y_[i], nx_[i], ny_[i])) {
+                    continue;
+                }
+                nx_[i] = x_[i];
+                ny_[i] = y_[i];
+                nvx_[i] = nvy_[i] = 0;
+            }
+        });
+        std::swap(x_, nx_);
+        std::swap(y_, ny_);
+        std::swap(vx_, nvx_);
+        std::swap(vy_, nvy_);
+    }
+
+    // log-weights of n ranges to the given anchors (variances may be null).
+    // All ranges are applied in one parallel pass, block by block, so each
+    // block of particles is read once from memory for all of them.
+    int weight(const float *anchors, const float *distances, const float *variances, size_t n)
+    {
+        const float z2 = opt_.outlier_z * opt_.outlier_z;
+        ranges_.clear();
+        for (size_t j = 0; j < n; ++j) {
+            if (!(std::isfinite(distances[j]) && distances[j] >= 0)) {
+                continue;
+            }
+            float v = variances && std::isfinite(variances[j]) ? variances[j] : opt_.default_variance;
+            ranges_.push_back(Range{anchors[2 * j], anchors[2 * j + 1], distances[j],
+                                    1.0f / std::max(std::sqrt(v), opt_.min_sigma)});
+        }
+        if (ranges_.empty()) {
+            return 0;
+        }
+        detail::parallel_chunks(n_, threads_, [&](size_t, size_t first, size_t last) {
+            for (size_t block = first; block < last; block += kWeightBlock) {
+                const size_t end = std::min(last, block + kWeightBlock);
+                for (const Range &r : ranges_) {
+                    detail::weight_range(x_.data(), y_.data(), lw_.data(), block, end, r.ax, r.ay, r.d,
+                                         r.inv_sigma, z2);
+                }
+            }
+        });
+        return int(ranges_.size());
+    }
+
+    // normalises the weights, computes the weighted mean and covariance and
+    // resamples if the effective sample size has dropped
+    ParticleEstimate estimate()
+    {
+        detail::parallel_chunks(n_, threads_, [&](size_t k, size_t first, size_t last) {
+            float m = -HUGE_VALF;
+            for (size_t i = first; i < last; ++i) {
+                m = std::max(m, lw_[i]);
+            }
+            partial_[k] = Partial{};
+            partial_[k].max = m;
+        });
+        float max_lw = -HUGE_VALF;
+        for (const Partial &p : partial_) {
+            max_lw = std::max(max_lw, p.max);
+        }
+
+        detail::parallel_chunks(n_, threads_, [&](size_t k, size_t first, size_t last) {
+            detail::normalise(lw_.data(), w_.data(), first, last, max_lw);
+            partial_[k].m = detail::moments(w_.data(), x_.data(), y_.data(), vx_.data(), vy_.data(), cdf_.data(),
+                                            first, last);
+        });
+        detail::Moments total{};
+        for (const Partial &p : partial_) {
+            total.w += p.m.w;
+            total.w2 += p.m.w2;
+            total.x += p.m.x;
+            total.y += p.m.y;
+            total.vx += p.m.vx;
+            total.vy += p.m.vy;
+            total.xx += p.m.xx;
+            total.xy += p.m.xy;
+            total.yy += p.m.yy;
+        }
+
+        ParticleEstimate e{};
+        double mx = total.x / total.w, my = total.y / total.w;
+        e.x = float(mx);
+        e.y = float(my);
+        e.vx = float(total.vx / total.w);
+        e.vy = float(total.vy / total.w);
+        e.cov_xx = float(std::max(total.xx / total.w - mx * mx, 0.0));
+        e.cov_xy = float(total.xy / total.w - mx * my);
+        e.cov_yy = float(std::max(total.yy / total.w - my * my, 0.0));
+        e.ess = float(total.w * total.w / total.w2);
+        if (e.ess < opt_.resample_threshold * n_) {
+            resample(total.w);
+            e.resampled = true;
+        }
+        return e;
+    }
+
+    // one round: predict over dt, weight with the ranges received since the
+    // previous round and estimate
+    ParticleEstimate step(float dt, const float *anchors, const float *distances, const float *variances, size_t n)
+    {
+        predict(dt);
+        int used = weight(anchors, distances, variances, n);
+        ParticleEstimate e = estimate();
+        e.n_ranges = used;
+        // residuals of the ranges the weights did not truncate, so NLOS ranges
+        // do not make a good estimate look lost
+        double sq = 0;
+        int inliers = 0;
+        for (size_t j = 0; j < n; ++j) {
+            if (std::isfinite(distances[j]) && distances[j] >= 0) {
+                float v = variances && std::isfinite(variances[j]) ? variances[j] : opt_.default_variance;
+                float sigma = std::max(std::sqrt(v), opt_.min_sigma);
+                float r = std::hypot(e.x - anchors[2 * j], e.y - anchors[2 * j + 1]) - distances[j];
+                if (std::fabs(r) <= opt_.outlier_z * sigma) {
+                    sq += double(r) * r;
+                    ++inliers;
+                }
+            }
+        }
+        e.rms = inliers ? float(std::sqrt(sq / inliers)) : NAN;
+        return e;
+    }
+
+private:
+    // x, y and log-weights of a block stay in L1 across all the ranges
+    static constexpr size_t kWeightBlock = 1024;
+
+    struct Range {
+        float ax, ay, d, inv_sigma;
+    };
+
+    struct Partial {
+        float max;
+        detail::Moments m;
+        double offset;      // cumulative weight of the chunks before this one
+    };
+
+    // systematic resampling: one uniform offset, n_ evenly spaced points on the
+    // cumulative weights. The per-chunk sums are turned into a global
+    // cumulative sum and every chunk of outputs searches it independently.
+    void resample(double total)
+    {
+        partial_[0].offset = 0;
+        for (size_t k = 1; k < threads_; ++k) {
+            partial_[k].offset = partial_[k - 1].offset + partial_[k - 1].m.w;
+        }
+        if (threads_ > 1) {
+            detail::parallel_chunks(n_, threads_, [&](size_t k, size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    cdf_[i] += partial_[k].offset;
+                }
+            });
+        }
+
+        const double step = total / n_;
+        const double u0 = detail::uniform(detail::hash32(opt_.seed ^ (++counter_ * 0x9e3779b9u))) * step;
+        detail::parallel_chunks(n_, threads_, [&](size_t, size_t first, size_t last) {
+            if (first >= last) {
+                return;
+            }
+            size_t src = std::lower_bound(cdf_.begin(), cdf_.end(), u0 + first * step) - cdf_.begin();
+            for (size_t i = first; i < last; ++i) {
+                const double target = u0 + i * step;
+                while (src + 1 < n_ && cdf_[src] < target) {
+                    ++src;
+                }
+                src = std::min(src, n_ - 1);
+                nx_[i] = x_[src];
+                ny_[i] = y_[src];
+                nvx_[i] = vx_[src];
+                nvy_[i] = vy_[src];
+            }
+        });
+        std::swap(x_, nx_);
+        std::swap(y_, ny_);
+        std::swap(vx_, nvx_);
+        std::swap(vy_, nvy_);
+        std::fill(lw_.begin(), lw_.end(), 0.0f);
+    }
+
+    const FloorPlan *plan_;
+    ParticleOptions opt_;
+    size_t n_;
+    size_t threads_ = 1;
+    uint32_t counter_ = 0;
+    std::vector<float> x_, y_, vx_, vy_, lw_;
+    std::vector<float> nx_, ny_, nvx_, nvy_;
+    std::vector<float> w_;
+    std::vector<double> cdf_;
+    std::vector<Partial> partial_;
+    std::vector<Range> ranges_;
+};
+
+}  // namespace ftm
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <string.h>
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static void put_u32(uint8_t *p, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = (v >> (8 * i)) & 0xFF;
+    }
+}
+
+static void put_u64(uint8_t *p, uint64_t v) {
+    for (int i = 0; i < 8; i++) {
+        p[i] = (v >> (8 * i)) & 0xFF;
+    }
+}
+
+static uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t get_u64(const uint8_t *p) {
+    return (uint64_t)get_u32(p) | ((uint64_t)get_u32(p + 4) << 32);
+}
+
+void ftm_uplink_init(ftm_uplink_frame_t *frame, const uint8_t mac_src[6], uint16_t seq, uint64_t ts_ms) {
+    memset(frame, 0, sizeof(*frame));
+    frame->header.magic = FTM_UPLINK_MAGIC;
+    frame->header.version = FTM_UPLINK_VERSION;
+    frame->header.type = FTM_UPLINK_TYPE_ROUND;
+    frame->header.seq = seq;
+    memcpy(frame->header.mac_src, mac_src, 6);
+    frame->header.ts_ms = ts_ms;
+}
+
+int ftm_uplink_add(ftm_uplink_frame_t *frame, const uint8_t mac_dst[6], uint32_t distance_cm, uint32_t rtt_ns, uint64_t ts_ms) {
+    if (frame->header.count >= FTM_UPLINK_MAX_ENTRIES) {
+        return -1;
+    }
+    ftm_uplink_entry_t *entry = &frame->entries[frame->header.count++];
+    memcpy(entry->mac_dst, mac_dst, 6);
+    entry->distance_cm = distance_cm;
+    entry->rtt_ns = rtt_ns;
+    entry->ts_offset_ms = (frame->header.ts_ms && ts_ms >= frame->header.ts_ms) ? (uint32_t)(ts_ms - frame->header.ts_ms) : 0;
+    return 0;
+}
+
+size_t ftm_uplink_encode(const ftm_uplink_frame_t *frame, uint8_t *buf, size_t len) {
+    size_t size = FTM_UPLINK_FRAME_SIZE(frame->header.count);
+    if (len < size) {
+        return 0;
+    }
+
+    uint8_t *p = buf;
+    *p++ = frame->header.magic;
+    *p++ = frame->header.version;
+    *p++ = frame->header.type;
+    *p++ = frame->header.count;
+    put_u16(p, frame->header.seq);
+    p += 2;
+    memcpy(p, frame->header.mac_src, 6);
+    p += 6;
+    put_u64(p, frame->header.ts_ms);
+    p += 8;
+
+    for (int i = 0; i < frame->header.count; i++) {
+        const ftm_uplink_entry_t *entry = &frame->entries[i];
+        memcpy(p, entry->mac_dst, 6);
+        put_u32(p + 6, entry->distance_cm);
+        put_u32(p + 10, entry->rtt_ns);
+        put_u32(p + 14, entry->ts_offset_ms);
+        p += sizeof(ftm_uplink_entry_t);
+    }
+    return size;
+}
+
+int ftm_uplink_decode(const uint8_t *buf, size_t len, ftm_uplink_frame_t *frame) {
+    if (len < sizeof(ftm_uplink_header_t) ||
+        buf[0] != FTM_UPLINK_MAGIC || buf[1] != FTM_UPLINK_VERSION || buf[2] != FTM_UPLINK_TYPE_ROUND) {
+        return -1;
+    }
+
+    uint8_t count = buf[3];
+    if (count > FTM_UPLINK_MAX_ENTRIES || len != FTM_UPLINK_FRAME_SIZE(count)) {
+        return -1;
+    }
+
+    uint64_t ts_ms = get_u64(buf + 12);
+    ftm_uplink_init(frame, buf + 6, get_u16(buf + 4), ts_ms);
+    const uint8_t *p = buf + sizeof(ftm_uplink_header_t);
+    for (int i = 0; i < count; i++) {
+        uint32_t ts_offset_ms = get_u32(p + 14);
+        ftm_uplink_add(frame, p, get_u32(p + 6), get_u32(p + 10), ts_ms ? ts_ms + ts_offset_ms : 0);
+        p += sizeof(ftm_uplink_entry_t);
+    }
+    return 0;
+}
+
+size_t ftm_uplink_encode_plan(const ftm_uplink_plan_t *plan, uint8_t *buf, size_t len) {
+    size_t size = FTM_UPLINK_PLAN_SIZE(plan->count);
+    if (plan->count > FTM_UPLINK_PLAN_MAX || len < size) {
+        return 0;
+    }
+
+    buf[0] = FTM_UPLINK_MAGIC;
+    buf[1] = FTM_UPLINK_VERSION;
+    buf[2] = FTM_UPLINK_TYPE_PLAN;
+    buf[3] = plan->count;
+    memcpy(buf + 4, plan->mac_tag, 6);
+    buf[10] = plan->flags;
+    put_u64(buf + 11, plan->rx_us);
+    put_u64(buf + 19, plan->tx_us);
+    memcpy(buf + 27, plan->anchors, (size_t)plan->count * 6);
+    return size;
+}
+
+int ftm_uplink_decode_plan(const uint8_t *buf, size_t len, ftm_uplink_plan_t *plan) {
+    if (len < FTM_UPLINK_PLAN_SIZE(0) ||
+        buf[0] != FTM_UPLINK_MAGIC || buf[1] != FTM_UPLINK_VERSION || buf[2] != FTM_UPLINK_TYPE_PLAN) {
+        return -1;
+    }
+
+    uint8_t count = buf[3];
+    if (count > FTM_UPLINK_PLAN_MAX || len != FTM_UPLINK_PLAN_SIZE(count)) {
+        return -1;
+    }
+
+    memset(plan, 0, sizeof(*plan));
+    plan->count = count;
+    memcpy(plan->mac_tag, buf + 4, 6);
+    plan->flags = buf[10];
+    plan->rx_us = get_u64(buf + 11);
+    plan->tx_us = get_u64(buf + 19);
+    memcpy(plan->anchors, buf + 27, (size_t)count * 6);
+    return 0;
+}
+
+int ftm_uplink_append_json(const ftm_uplink_frame_t *frame, char *buf, size_t len, int *first) {
+    char mac_src[FTM_MAC_STR_LEN];
+    char mac_dst[FTM_MAC_STR_LEN];
+    const int was_first = *first;
+    size_t used = 0;
+
+    ftm_mac_format(frame->header.mac_src, mac_src);
+    for (int i = 0; i < frame->header.count; i++) {
+        const ftm_uplink_entry_t *entry = &frame->entries[i];
+        ftm_mac_format(entry->mac_dst, mac_dst);
+        uint64_t ts_ms = frame->header.ts_ms ? frame->header.ts_ms + entry->ts_offset_ms : 0;
+        int n = snprintf(buf + used, len - used,
+                         "%s{"
+                         "\"mac_src\":\"%s\","
+                         "\"mac_dst\":\"%s\","
+                         "\"distance_cm\":%.2f,"
+                         "\"rtt_ns\":%.2f,"
+                         "\"ts_ms\":%llu,"
+                         "\"seq\":%u"
+                         "}",
+                         *first ? "" : ",",
+                         mac_src, mac_dst,
+                         (double)entry->distance_cm, (double)entry->rtt_ns,
+                         (unsigned long long)ts_ms, (unsigned)frame->header.seq);
+        if (n < 0 || (size_t)n >= len - used) {
+            buf[0] = '\0';
+            *first = was_first;
+            return -1;
+        }
+        used += n;
+        *first = 0;
+    }
+    return (int)used;
+}
+
+void ftm_uplink_batch_init(ftm_uplink_batch_t *batch, char *buf, size_t size, ftm_uplink_publish_fn publish, void *ctx) {
+    batch->buf = buf;
+    batch->size = size;
+    batch->publish = publish;
+    batch->ctx = ctx;
+    batch->used = 1;
+    batch->first = 1;
+    buf[0] = '[';
+}
+
+int ftm_uplink_batch_add(ftm_uplink_batch_t *batch, const ftm_uplink_frame_t *frame) {
+    /* keep room for the closing bracket */
+    int n = ftm_uplink_append_json(frame, batch->buf + batch->used, batch->size - batch->used - 1, &batch->first);
+    if (n < 0 && !batch->first) {
+        ftm_uplink_batch_flush(batch);
+        n = ftm_uplink_append_json(frame, batch->buf + batch->used, batch->size - batch->used - 1, &batch->first);
+    }
+    if (n < 0) {
+        return -1;
+    }
+    batch->used += n;
+    return 0;
+}
+
+void ftm_uplink_batch_flush(ftm_uplink_batch_t *batch) {
+    if (!batch->first) {
+        batch->buf[batch->used] = ']';
+        batch->buf[batch->used + 1] = '\0';
+        batch->publish(batch->buf, batch->used + 1, batch->ctx);
+    }
+    batch->used = 1;
+    batch->first = 1;
+    batch->buf[0] = '[';
+}
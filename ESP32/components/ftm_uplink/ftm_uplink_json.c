@@ -0,0 +1,28 @@
+#include <string.h>
+#include "cJSON.h"
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+
+/* Apart from the frame codec because it is the only code that needs cJSON;
+ * without it the codec also builds on the host (see host_test) */
+
+int ftm_uplink_plan_from_json(const char *json, size_t len, ftm_uplink_plan_t *plan) {
+    cJSON *root = cJSON_ParseWithLength(json, len);
+    const cJSON *anchors = root ? cJSON_GetObjectItem(root, "anchors") : NULL;
+    if (!cJSON_IsArray(anchors)) {
+        cJSON_Delete(root);
+        return -1;
+    }
+
+    plan->count = 0;
+    const cJSON *item;
+    cJSON_ArrayForEach(item, anchors) {
+        if (plan->count < FTM_UPLINK_PLAN_MAX && cJSON_IsString(item) &&
+            ftm_mac_parse(item->valuestring, strlen(item->valuestring), plan->anchors[plan->count]) == 0) {
+            plan->count++;
+        }
+    }
+    plan->flags |= FTM_UPLINK_PLAN_ANCHORS;
+    cJSON_Delete(root);
+    return 0;
+}
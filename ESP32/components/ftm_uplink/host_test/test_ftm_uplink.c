@@ -0,0 +1,326 @@
+/* Host test of the ftm_uplink frame codec: round reports and ranging plans
+ * are encoded, decoded and compared, truncated and corrupted buffers must be
+ * rejected, and the JSON the gateway publishes must match the frame and
+ * respect the buffer limit. Built and run by host_test/CMakeLists.txt
+ * (ctest). */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+
+static int failures;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+static const uint8_t TAG_MAC[6] = {0x24, 0x6F, 0x28, 0xAA, 0xBB, 0xCC};
+static const uint64_t ROUND_TS_MS = 1760000000123ULL;
+
+static void anchor_mac(int i, uint8_t mac[6]) {
+    const uint8_t base[6] = {0x30, 0xAE, 0xA4, 0x00, 0x10, 0x00};
+    memcpy(mac, base, 6);
+    mac[5] = (uint8_t)i;
+}
+
+/* A frame with n entries, measured 40 ms apart after the round start */
+static void build_frame(ftm_uplink_frame_t *frame, int n, uint64_t ts_ms) {
+    ftm_uplink_init(frame, TAG_MAC, 0xBEEF, ts_ms);
+    for (int i = 0; i < n; i++) {
+        uint8_t mac[6];
+        anchor_mac(i, mac);
+        CHECK(ftm_uplink_add(frame, mac, 100 + 37 * i, 7 * i, ts_ms ? ts_ms + 40 * i : 0) == 0);
+    }
+}
+
+static int frames_equal(const ftm_uplink_frame_t *a, const ftm_uplink_frame_t *b) {
+    if (a->header.magic != b->header.magic || a->header.version != b->header.version ||
+        a->header.type != b->header.type || a->header.count != b->header.count ||
+        a->header.seq != b->header.seq || a->header.ts_ms != b->header.ts_ms ||
+        memcmp(a->header.mac_src, b->header.mac_src, 6) != 0) {
+        return 0;
+    }
+    for (int i = 0; i < a->header.count; i++) {
+        const ftm_uplink_entry_t *x = &a->entries[i], *y = &b->entries[i];
+        if (memcmp(x->mac_dst, y->mac_dst, 6) != 0 || x->distance_cm != y->distance_cm ||
+            x->rtt_ns != y->rtt_ns || x->ts_offset_ms != y->ts_offset_ms) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void test_round_trip(void) {
+    uint8_t buf[256];
+    const int counts[] = {0, 1, 5, FTM_UPLINK_MAX_ENTRIES};
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        for (int synced = 0; synced < 2; synced++) {
+            ftm_uplink_frame_t frame, decoded;
+            build_frame(&frame, counts[k], synced ? ROUND_TS_MS : 0);
+            size_t size = ftm_uplink_encode(&frame, buf, sizeof(buf));
+            CHECK(size == FTM_UPLINK_FRAME_SIZE(counts[k]));
+            CHECK(ftm_uplink_decode(buf, size, &decoded) == 0);
+            CHECK(frames_equal(&frame, &decoded));
+        }
+    }
+
+    /* a full frame fits an ESP-NOW payload (250 bytes) */
+    CHECK(FTM_UPLINK_FRAME_SIZE(FTM_UPLINK_MAX_ENTRIES) <= 250);
+
+    /* little endian on the air, whatever the host */
+    ftm_uplink_frame_t frame;
+    build_frame(&frame, 1, ROUND_TS_MS);
+    CHECK(ftm_uplink_encode(&frame, buf, sizeof(buf)) > 0);
+    CHECK(buf[4] == 0xEF && buf[5] == 0xBE);
+    CHECK(buf[12] == (ROUND_TS_MS & 0xFF));
+}
+
+static void test_full_frame(void) {
+    ftm_uplink_frame_t frame;
+    build_frame(&frame, FTM_UPLINK_MAX_ENTRIES, ROUND_TS_MS);
+    uint8_t mac[6];
+    anchor_mac(99, mac);
+    CHECK(ftm_uplink_add(&frame, mac, 1, 1, ROUND_TS_MS) == -1);
+    CHECK(frame.header.count == FTM_UPLINK_MAX_ENTRIES);
+
+    /* the encoder does not write past a short buffer */
+    uint8_t buf[256];
+    memset(buf, 0xA5, sizeof(buf));
+    CHECK(ftm_uplink_encode(&frame, buf, FTM_UPLINK_FRAME_SIZE(FTM_UPLINK_MAX_ENTRIES) - 1) == 0);
+    CHECK(buf[0] == 0xA5);
+}
+
+static void test_rejects_bad_frames(void) {
+    ftm_uplink_frame_t frame, decoded;
+    uint8_t buf[256];
+    build_frame(&frame, 4, ROUND_TS_MS);
+    size_t size = ftm_uplink_encode(&frame, buf, sizeof(buf));
+
+    /* every truncation, and one byte too many */
+    for (size_t len = 0; len < size; len++) {
+        CHECK(ftm_uplink_decode(buf, len, &decoded) == -1);
+    }
+    CHECK(ftm_uplink_decode(buf, size + 1, &decoded) == -1);
+
+    uint8_t bad[256];
+    const size_t fields[] = {0, 1, 2};  /* magic, version, type */
+    for (size_t k = 0; k < sizeof(fields) / sizeof(fields[0]); k++) {
+        memcpy(bad, buf, size);
+        bad[fields[k]] ^= 0xFF;
+        CHECK(ftm_uplink_decode(bad, size, &decoded) == -1);
+    }
+
+    /* a count that disagrees with the length, or above the maximum */
+    memcpy(bad, buf, size);
+    bad[3] = 5;
+    CHECK(ftm_uplink_decode(bad, size, &decoded) == -1);
+    memcpy(bad, buf, size);
+    bad[3] = FTM_UPLINK_MAX_ENTRIES + 1;
+    CHECK(ftm_uplink_decode(bad, FTM_UPLINK_FRAME_SIZE(FTM_UPLINK_MAX_ENTRIES + 1), &decoded) == -1);
+
+    /* a plan is not a round report, and the other way round */
+    ftm_uplink_plan_t plan;
+    CHECK(ftm_uplink_decode_plan(buf, size, &plan) == -1);
+}
+
+static void test_plan_round_trip(void) {
+    uint8_t buf[128];
+    const int counts[] = {0, 1, 7, FTM_UPLINK_PLAN_MAX};
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        ftm_uplink_plan_t plan, decoded;
+        memset(&plan, 0, sizeof(plan));
+        memcpy(plan.mac_tag, TAG_MAC, 6);
+        plan.count = (uint8_t)counts[k];
+        plan.flags = k % 2 ? FTM_UPLINK_PLAN_ANCHORS | FTM_UPLINK_PLAN_TIME : FTM_UPLINK_PLAN_TIME;
+        plan.rx_us = ROUND_TS_MS * 1000 + 417;
+        plan.tx_us = plan.rx_us + 2301;
+        for (int i = 0; i < counts[k]; i++) {
+            anchor_mac(i, plan.anchors[i]);
+        }
+        size_t size = ftm_uplink_encode_plan(&plan, buf, sizeof(buf));
+        CHECK(size == FTM_UPLINK_PLAN_SIZE(counts[k]));
+        CHECK(ftm_uplink_decode_plan(buf, size, &decoded) == 0);
+        CHECK(memcmp(&plan, &decoded, sizeof(plan)) == 0);
+    }
+    CHECK(FTM_UPLINK_PLAN_SIZE(FTM_UPLINK_PLAN_MAX) <= 250);
+}
+
+static void test_plan_rejects_bad_frames(void) {
+    ftm_uplink_plan_t plan, decoded;
+    uint8_t buf[128];
+    memset(&plan, 0, sizeof(plan));
+    memcpy(plan.mac_tag, TAG_MAC, 6);
+    plan.count = 3;
+    for (int i = 0; i < 3; i++) {
+        anchor_mac(i, plan.anchors[i]);
+    }
+    size_t size = ftm_uplink_encode_plan(&plan, buf, sizeof(buf));
+
+    /* short output buffer and too many anchors */
+    CHECK(ftm_uplink_encode_plan(&plan, buf, size - 1) == 0);
+    ftm_uplink_plan_t big = plan;
+    big.count = FTM_UPLINK_PLAN_MAX + 1;
+    CHECK(ftm_uplink_encode_plan(&big, buf, sizeof(buf)) == 0);
+    size = ftm_uplink_encode_plan(&plan, buf, sizeof(buf));
+
+    for (size_t len = 0; len < size; len++) {
+        CHECK(ftm_uplink_decode_plan(buf, len, &decoded) == -1);
+    }
+    CHECK(ftm_uplink_decode_plan(buf, size + 1, &decoded) == -1);
+
+    uint8_t bad[128];
+    for (size_t field = 0; field < 3; field++) {
+        memcpy(bad, buf, size);
+        bad[field] ^= 0xFF;
+        CHECK(ftm_uplink_decode_plan(bad, size, &decoded) == -1);
+    }
+    memcpy(bad, buf, size);
+    bad[3] = 2;
+    CHECK(ftm_uplink_decode_plan(bad, size, &decoded) == -1);
+
+    ftm_uplink_frame_t frame;
+    CHECK(ftm_uplink_decode(buf, size, &frame) == -1);
+}
+
+static void test_json(void) {
+    ftm_uplink_frame_t frame;
+    build_frame(&frame, 2, ROUND_TS_MS);
+
+    char buf[1024];
+    int first = 1;
+    int n = ftm_uplink_append_json(&frame, buf, sizeof(buf), &first);
+    CHECK(n > 0 && (size_t)n == strlen(buf));
+    CHECK(first == 0);
+    CHECK(strcmp(buf,
+                 "{\"mac_src\":\"24:6F:28:AA:BB:CC\",\"mac_dst\":\"30:AE:A4:00:10:00\","
+                 "\"distance_cm\":100.00,\"rtt_ns\":0.00,\"ts_ms\":1760000000123,\"seq\":48879},"
+                 "{\"mac_src\":\"24:6F:28:AA:BB:CC\",\"mac_dst\":\"30:AE:A4:00:10:01\","
+                 "\"distance_cm\":137.00,\"rtt_ns\":7.00,\"ts_ms\":1760000000163,\"seq\":48879}") == 0);
+
+    /* a second frame in the same array is preceded by a comma */
+    int m = ftm_uplink_append_json(&frame, buf + n, sizeof(buf) - n, &first);
+    CHECK(m > 0 && buf[n] == ',');
+
+    /* unsynchronised tags report ts_ms 0 */
+    ftm_uplink_frame_t unsynced;
+    build_frame(&unsynced, 1, 0);
+    first = 1;
+    CHECK(ftm_uplink_append_json(&unsynced, buf, sizeof(buf), &first) > 0);
+    CHECK(strstr(buf, "\"ts_ms\":0,") != NULL);
+
+    /* a frame with no entries writes nothing and leaves first set */
+    ftm_uplink_frame_t empty;
+    build_frame(&empty, 0, ROUND_TS_MS);
+    first = 1;
+    CHECK(ftm_uplink_append_json(&empty, buf, sizeof(buf), &first) == 0);
+    CHECK(first == 1);
+}
+
+static void test_json_limit(void) {
+    ftm_uplink_frame_t frame;
+    build_frame(&frame, FTM_UPLINK_MAX_ENTRIES, ROUND_TS_MS);
+
+    char full[4096];
+    int first = 1;
+    int needed = ftm_uplink_append_json(&frame, full, sizeof(full), &first);
+    CHECK(needed > 0);
+
+    /* exactly enough room (text plus terminator) fits */
+    char *buf = malloc((size_t)needed + 1);
+    first = 1;
+    CHECK(ftm_uplink_append_json(&frame, buf, (size_t)needed + 1, &first) == needed);
+    CHECK(strcmp(buf, full) == 0);
+
+    /* one byte less fails, leaves an empty string and does not touch first
+     * or write past the buffer */
+    for (size_t len = 1; len <= (size_t)needed; len += (len < 64 ? 1 : 97)) {
+        char *small = malloc(len + 1);
+        small[len] = 'X';
+        first = 1;
+        CHECK(ftm_uplink_append_json(&frame, small, len, &first) == -1);
+        CHECK(small[0] == '\0');
+        CHECK(first == 1);
+        CHECK(small[len] == 'X');
+        free(small);
+    }
+    free(buf);
+}
+
+struct published {
+    int count;
+    char last[1024];
+};
+
+static void collect(const char *json, size_t len, void *ctx) {
+    struct published *out = ctx;
+    CHECK(len == strlen(json) && len < sizeof(out->last));
+    memcpy(out->last, json, len + 1);
+    out->count++;
+}
+
+static void test_batch(void) {
+    ftm_uplink_frame_t frame;
+    build_frame(&frame, 1, ROUND_TS_MS);
+
+    char one[512];
+    int first = 1;
+    int entry = ftm_uplink_append_json(&frame, one, sizeof(one), &first);
+    CHECK(entry > 0);
+
+    /* room for exactly two frames: brackets, two entries, a comma and the terminator */
+    char *buf = malloc((size_t)entry * 2 + 4);
+    struct published out = {0};
+    ftm_uplink_batch_t batch;
+    ftm_uplink_batch_init(&batch, buf, (size_t)entry * 2 + 4, collect, &out);
+
+    /* nothing is published for an empty batch */
+    ftm_uplink_batch_flush(&batch);
+    CHECK(out.count == 0);
+
+    CHECK(ftm_uplink_batch_add(&batch, &frame) == 0);
+    CHECK(ftm_uplink_batch_add(&batch, &frame) == 0);
+    CHECK(out.count == 0);
+
+    /* the third frame closes the first array and starts the next one */
+    CHECK(ftm_uplink_batch_add(&batch, &frame) == 0);
+    CHECK(out.count == 1);
+    CHECK(out.last[0] == '[' && out.last[strlen(out.last) - 1] == ']');
+    CHECK(strlen(out.last) == (size_t)entry * 2 + 3);
+
+    ftm_uplink_batch_flush(&batch);
+    CHECK(out.count == 2);
+    CHECK(strlen(out.last) == (size_t)entry + 2);
+    CHECK(strncmp(out.last + 1, one, (size_t)entry) == 0);
+
+    /* a frame larger than the whole buffer is refused and publishes nothing */
+    ftm_uplink_frame_t full;
+    build_frame(&full, FTM_UPLINK_MAX_ENTRIES, ROUND_TS_MS);
+    CHECK(ftm_uplink_batch_add(&batch, &full) == -1);
+    ftm_uplink_batch_flush(&batch);
+    CHECK(out.count == 2);
+    free(buf);
+}
+
+int main(void) {
+    test_round_trip();
+    test_full_frame();
+    test_rejects_bad_frames();
+    test_plan_round_trip();
+    test_plan_rejects_bad_frames();
+    test_json();
+    test_json_limit();
+    test_batch();
+
+    if (failures) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("ftm_uplink: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,155 @@
+/* Host loopback of the ESP-NOW uplink along the path a round actually takes:
+ * the tag fills and encodes frames, the gateway decodes them and batches the
+ * JSON it forwards to MQTT, and the ingest daemon's parse_message reads the
+ * published messages back. Every measurement must arrive with its tag and
+ * anchor MACs, distance, RTT, time and round number. Built and run by
+ * host_test/CMakeLists.txt (ctest). */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+#include "payload.hpp"
+
+static int failures;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                     \
+        }                                                                   \
+    } while (0)
+
+/* same size as the gateway's buffer (ESPNOW_JSON_SIZE in anchor/main) */
+static constexpr size_t GATEWAY_JSON_SIZE = 4096;
+static constexpr uint64_t ROUND_TS_MS = 1760000000123ULL;
+
+struct Sent {
+    uint8_t tag[6];
+    uint8_t anchor[6];
+    uint32_t distance_cm;
+    uint32_t rtt_ns;
+    uint64_t ts_ms;
+    uint16_t seq;
+};
+
+/* A round of a tag as ftm_session_task reports it: n anchors measured 40 ms
+ * apart, ts_ms 0 when the tag is not synchronised */
+static std::vector<uint8_t> tag_round(int tag, uint16_t seq, int n, uint64_t ts_ms, std::vector<Sent> &sent) {
+    const uint8_t mac_tag[6] = {0x24, 0x6F, 0x28, 0xAA, 0xBB, (uint8_t)tag};
+    ftm_uplink_frame_t frame;
+    ftm_uplink_init(&frame, mac_tag, seq, ts_ms);
+    for (int i = 0; i < n; i++) {
+        Sent s = {};
+        memcpy(s.tag, mac_tag, 6);
+        const uint8_t mac_anchor[6] = {0x30, 0xAE, 0xA4, 0x00, 0x10, (uint8_t)i};
+        memcpy(s.anchor, mac_anchor, 6);
+        s.distance_cm = 100 + 37 * i + tag;
+        s.rtt_ns = 7 * i;
+        s.ts_ms = ts_ms ? ts_ms + 40 * i : 0;
+        s.seq = seq;
+        CHECK(ftm_uplink_add(&frame, s.anchor, s.distance_cm, s.rtt_ns, s.ts_ms) == 0);
+        sent.push_back(s);
+    }
+
+    std::vector<uint8_t> air(FTM_UPLINK_FRAME_SIZE(n));
+    CHECK(ftm_uplink_encode(&frame, air.data(), air.size()) == air.size());
+    return air;
+}
+
+static void publish(const char *json, size_t len, void *ctx) {
+    static_cast<std::vector<std::string> *>(ctx)->emplace_back(json, len);
+}
+
+/* gateway_task without the queue and the timer: decode and batch */
+static std::vector<std::string> gateway(const std::vector<std::vector<uint8_t>> &received) {
+    static char json[GATEWAY_JSON_SIZE];
+    std::vector<std::string> published;
+    ftm_uplink_batch_t batch;
+    ftm_uplink_batch_init(&batch, json, sizeof(json), publish, &published);
+
+    for (const std::vector<uint8_t> &rx : received) {
+        ftm_uplink_frame_t frame;
+        if (ftm_uplink_decode(rx.data(), rx.size(), &frame) != 0) {
+            continue;
+        }
+        CHECK(ftm_uplink_batch_add(&batch, &frame) == 0);
+    }
+    ftm_uplink_batch_flush(&batch);
+    return published;
+}
+
+static void check_row(const MeasurementRow &row, const Sent &s) {
+    CHECK(row.mac_src == ftm_mac_to_u64(s.tag));
+    CHECK(row.mac_dst == ftm_mac_to_u64(s.anchor));
+    CHECK(row.distance_cm == s.distance_cm);
+    CHECK(row.rtt_ns == s.rtt_ns);
+    CHECK(row.seq && *row.seq == s.seq);
+    if (s.ts_ms) {
+        CHECK(row.ts_ms && *row.ts_ms == (int64_t)s.ts_ms);
+    } else {
+        CHECK(!row.ts_ms);
+    }
+}
+
+static void test_loopback(void) {
+    std::vector<Sent> sent;
+    std::vector<std::vector<uint8_t>> air;
+
+    /* full, partial, empty and unsynchronised rounds of several tags, with a
+     * seq that wraps around */
+    air.push_back(tag_round(1, 0xFFFF, FTM_UPLINK_MAX_ENTRIES, ROUND_TS_MS, sent));
+    air.push_back(tag_round(2, 0, 3, ROUND_TS_MS + 5, sent));
+    air.push_back(tag_round(3, 42, 0, ROUND_TS_MS, sent));
+    air.push_back(tag_round(4, 7, 2, 0, sent));
+
+    /* a corrupted frame is dropped by the gateway and does not reach MQTT */
+    std::vector<uint8_t> bad = air[1];
+    bad[1] ^= 0xFF;
+    air.push_back(bad);
+
+    /* enough full rounds to overflow the gateway buffer */
+    for (int k = 0; k < 8; k++) {
+        air.push_back(tag_round(10 + k, (uint16_t)(100 + k), FTM_UPLINK_MAX_ENTRIES, ROUND_TS_MS + 1000 * k, sent));
+    }
+
+    std::vector<std::string> published = gateway(air);
+    CHECK(published.size() > 1);
+
+    size_t next = 0;
+    for (const std::string &payload : published) {
+        CHECK(payload.size() < GATEWAY_JSON_SIZE);
+        try {
+            Message msg = parse_message(payload);
+            CHECK(msg.anchors.empty());
+            CHECK(!msg.measurements.empty());
+            for (const MeasurementRow &row : msg.measurements) {
+                CHECK(next < sent.size());
+                if (next < sent.size()) {
+                    check_row(row, sent[next]);
+                }
+                next++;
+            }
+        } catch (const std::exception &e) {
+            fprintf(stderr, "parse_message: %s\n", e.what());
+            failures++;
+        }
+    }
+    CHECK(next == sent.size());
+}
+
+int main(void) {
+    test_loopback();
+
+    if (failures) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("loopback: all checks passed\n");
+    return 0;
+}
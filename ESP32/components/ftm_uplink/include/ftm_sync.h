@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Time sync element carried as a vendor IE in the anchors' SoftAP beacons and
+ * probe responses. The payload is a flags byte followed by the anchor's
+ * SNTP time in milliseconds since the epoch, little endian. */
+
+#define FTM_SYNC_OUI            {0x18, 0xFE, 0x34}
+#define FTM_SYNC_OUI_TYPE       0xF7
+#define FTM_SYNC_FLAG_SYNCED    0x01
+#define FTM_SYNC_PAYLOAD_LEN    9
+
+static inline void ftm_sync_pack(uint8_t *payload, uint64_t epoch_ms, bool synced) {
+    payload[0] = synced ? FTM_SYNC_FLAG_SYNCED : 0;
+    for (int i = 0; i < 8; i++) {
+        payload[1 + i] = (epoch_ms >> (8 * i)) & 0xFF;
+    }
+}
+
+/* Returns true only for a well formed payload from a synchronised anchor */
+static inline bool ftm_sync_unpack(const uint8_t *payload, size_t len, uint64_t *epoch_ms) {
+    if (len < FTM_SYNC_PAYLOAD_LEN || !(payload[0] & FTM_SYNC_FLAG_SYNCED)) {
+        return false;
+    }
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= (uint64_t)payload[1 + i] << (8 * i);
+    }
+    *epoch_ms = value;
+    return true;
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Binary round report sent by a tag to a gateway anchor over ESP-NOW.
+ * The gateway turns it into the same JSON array the tag would publish
+ * on the "data" topic, so the backend does not need to know the path. */
+
+#define FTM_UPLINK_MAGIC        0x46
+#define FTM_UPLINK_VERSION      3
+#define FTM_UPLINK_TYPE_ROUND   1
+#define FTM_UPLINK_TYPE_PLAN    2
+#define FTM_UPLINK_MAX_ENTRIES  12
+#define FTM_UPLINK_SSID_PREFIX  "ftmgw_"
+
+typedef struct __attribute__((packed)) {
+    uint8_t magic;
+    uint8_t version;
+    uint8_t type;
+    uint8_t count;
+    uint16_t seq;
+    uint8_t mac_src[6];
+    uint64_t ts_ms;         /* synchronised time of the round start, 0 if unknown */
+} ftm_uplink_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint8_t mac_dst[6];
+    uint32_t distance_cm;
+    uint32_t rtt_ns;
+    uint32_t ts_offset_ms;  /* measurement time relative to header.ts_ms */
+} ftm_uplink_entry_t;
+
+typedef struct {
+    ftm_uplink_header_t header;
+    ftm_uplink_entry_t entries[FTM_UPLINK_MAX_ENTRIES];
+} ftm_uplink_frame_t;
+
+/* 236 bytes for a full frame, below the 250 byte ESP-NOW payload limit */
+#define FTM_UPLINK_FRAME_SIZE(count) (sizeof(ftm_uplink_header_t) + (count) * sizeof(ftm_uplink_entry_t))
+
+/* Reply the gateway sends back to a tag after each round. With
+ * FTM_UPLINK_PLAN_ANCHORS it carries the ranging plan: the anchors the backend
+ * picked for the tag's last position. The tag ranges only those, and all of
+ * them when count is 0. With FTM_UPLINK_PLAN_TIME it carries the gateway's
+ * SNTP time when the round arrived and when the reply left, in microseconds
+ * since the epoch. Together with its own send and receive times the tag gets
+ * its clock offset as in NTP, without the delays of the beacon time IE. */
+#define FTM_UPLINK_PLAN_MAX     FTM_UPLINK_MAX_ENTRIES
+#define FTM_UPLINK_PLAN_ANCHORS 0x01
+#define FTM_UPLINK_PLAN_TIME    0x02
+
+typedef struct {
+    uint8_t count;
+    uint8_t flags;
+    uint8_t mac_tag[6];
+    uint64_t rx_us;         /* gateway time when the round was received */
+    uint64_t tx_us;         /* gateway time when the reply was sent */
+    uint8_t anchors[FTM_UPLINK_PLAN_MAX][6];
+} ftm_uplink_plan_t;
+
+/* magic, version, type, count, tag MAC, flags, rx_us, tx_us and 6 bytes per anchor */
+#define FTM_UPLINK_PLAN_SIZE(count) (27 + (size_t)(count) * 6)
+
+void ftm_uplink_init(ftm_uplink_frame_t *frame, const uint8_t mac_src[6], uint16_t seq, uint64_t ts_ms);
+
+/* Returns 0 on success, -1 when the frame is full. ts_ms is the synchronised
+ * measurement time, or 0 if the tag is not synchronised. */
+int ftm_uplink_add(ftm_uplink_frame_t *frame, const uint8_t mac_dst[6], uint32_t distance_cm, uint32_t rtt_ns, uint64_t ts_ms);
+
+/* Serialises the frame in little endian; returns the number of bytes written */
+size_t ftm_uplink_encode(const ftm_uplink_frame_t *frame, uint8_t *buf, size_t len);
+
+/* Returns 0 on success, -1 if the buffer is not a valid round report */
+int ftm_uplink_decode(const uint8_t *buf, size_t len, ftm_uplink_frame_t *frame);
+
+/* Serialises a ranging plan; returns the number of bytes written, 0 if it does not fit */
+size_t ftm_uplink_encode_plan(const ftm_uplink_plan_t *plan, uint8_t *buf, size_t len);
+
+/* Returns 0 on success, -1 if the buffer is not a valid ranging plan */
+int ftm_uplink_decode_plan(const uint8_t *buf, size_t len, ftm_uplink_plan_t *plan);
+
+/* Reads the anchors of a plan published by the backend as
+ * {"anchors": ["AA:BB:CC:DD:EE:FF", ...]} and sets FTM_UPLINK_PLAN_ANCHORS;
+ * mac_tag and the times are left untouched.
+ * Returns 0 on success, -1 if the message is not a plan. */
+int ftm_uplink_plan_from_json(const char *json, size_t len, ftm_uplink_plan_t *plan);
+
+/* Appends the entries as JSON objects to an array being built in buf.
+ * first is cleared once something has been written. Returns the number of
+ * characters written, or -1 if they do not fit. */
+int ftm_uplink_append_json(const ftm_uplink_frame_t *frame, char *buf, size_t len, int *first);
+
+/* JSON array of round reports that a gateway forwards as one MQTT message.
+ * publish receives the closed array, NUL terminated, whenever the next frame
+ * does not fit and on ftm_uplink_batch_flush. */
+typedef void (*ftm_uplink_publish_fn)(const char *json, size_t len, void *ctx);
+
+typedef struct {
+    char *buf;
+    size_t size;
+    size_t used;
+    int first;
+    ftm_uplink_publish_fn publish;
+    void *ctx;
+} ftm_uplink_batch_t;
+
+/* buf must hold at least the brackets and the terminator */
+void ftm_uplink_batch_init(ftm_uplink_batch_t *batch, char *buf, size_t size, ftm_uplink_publish_fn publish, void *ctx);
+
+/* Returns 0 on success, -1 if the frame does not fit even in an empty batch */
+int ftm_uplink_batch_add(ftm_uplink_batch_t *batch, const ftm_uplink_frame_t *frame);
+
+/* Publishes the array if it holds any entry and starts a new one */
+void ftm_uplink_batch_flush(ftm_uplink_batch_t *batch);
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,7 +11,14 @@
 #include "esp_wifi.h"
 #include "esp_mac.h"
 #include "mqtt_client.h"
+#include "cJSON.h"
 #include "esp_sntp.h"
+#include "esp_now.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "ftm_uplink.h"
+#include "ftm_mac.h"
+#include "ftm_sync.h"
 
 #define N_MAX_ANCHORS 8
 #define SESIONES_POR_RONDA 8
@@ -21,6 +28,47 @@
 #define MQTT_URI         "mqtt://172.20.10.13:1884"
 #define MQTT_TOPIC       "data"
 
+// modo calibración: el tag se coloca a DISTANCIA_REFERENCIA_CM del anchor a calibrar
+// y publica las medidas en MQTT_TOPIC_CALIB para calcular el offset del anchor
+#define MODO_CALIBRACION         0
+#define DISTANCIA_REFERENCIA_CM  100
+#define MQTT_TOPIC_CALIB         "calibration"
+
+// envío de la ronda por ESP-NOW a un anchor gateway (SSID FTM_UPLINK_SSID_PREFIX);
+// si no hay gateway o el envío falla se usa la conexión MQTT
+#define UPLINK_ESPNOW            1
+#define ESPNOW_REINTENTOS        3
+// el gateway responde a cada ronda con su hora al recibirla y al contestar; con las
+// horas propias de envío y llegada dan el offset del reloj como en NTP, sin el
+// retraso de hasta 100 ms del IE de los beacons. No se usa una respuesta cuyo viaje
+// de ida y vuelta pase de SYNC_RTT_MAX_MS, y el offset del gateway prevalece sobre
+// el del IE durante SYNC_GATEWAY_VALIDEZ_MS
+#define SYNC_RTT_MAX_MS          20
+#define SYNC_GATEWAY_VALIDEZ_MS  90000
+
+// las rondas empiezan en múltiplos de PERIODO_RONDA_MS del tiempo que anuncian
+// los anchors, desplazadas según la ranura del tag (último byte de su MAC)
+#define PERIODO_RONDA_MS         30000
+#define RANURAS_RONDA            1
+
+// plan de medida: el backend elige desde la última posición del tag los anchors que
+// bastan para la precisión objetivo (planificar_medidas.py) y lo publica en
+// MQTT_TOPIC_PLAN<MAC>; el gateway lo devuelve por ESP-NOW tras cada ronda. Se miden
+// primero los anchors del plan y los demás solo si no se llega a MIN_ANCLAS_RONDA,
+// salvo cada RONDAS_COMPLETAS rondas, en las que se miden todos para que el backend
+// siga conociendo los que quedan fuera
+#define PLAN_MEDIDAS             1
+#define MQTT_TOPIC_PLAN          "plan/"
+#define RONDAS_COMPLETAS         10
+#define MIN_ANCLAS_RONDA         3
+#define PLAN_ESPERA_MS           100
+
+#if MODO_CALIBRACION
+#define MQTT_TOPIC_RONDA MQTT_TOPIC_CALIB
+#else
+#define MQTT_TOPIC_RONDA MQTT_TOPIC
+#endif
+
 static const char *TAG = "FTM_TAG";
 static uint8_t mac_tag[6];
 
@@ -40,18 +88,59 @@ static esp_mqtt_client_handle_t mqtt_client = NULL;
 static uint32_t s_rtt_est = 0, s_dist_est = 0;
 static anchor_info_t anchor_info = {0};
 
+static wifi_ap_record_t gateway_record;
+static bool gateway_found = false;
+static uint16_t uplink_seq = 0;
+
+// diferencia entre el tiempo de los anchors y esp_timer, en ms
+static portMUX_TYPE sync_mux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t sync_offset_ms = 0;
+static int64_t sync_candidate_ms = INT64_MIN;
+static bool sync_valid = false;
+static int64_t gateway_sync_us = 0;   // esp_timer de la última hora del gateway
+static int64_t espnow_sent_us = 0;    // esp_timer del último envío de una ronda
+
+static portMUX_TYPE plan_mux = portMUX_INITIALIZER_UNLOCKED;
+static ftm_uplink_plan_t ranging_plan = {0};
+static char plan_topic[32];
+static uint32_t round_count = 0;
+
 const int FTM_REPORT_BIT = BIT0;
 const int FTM_FAILURE_BIT = BIT1;
+const int ESPNOW_SENT_BIT = BIT2;
+const int ESPNOW_FAIL_BIT = BIT3;
+const int PLAN_RECEIVED_BIT = BIT4;
+
+static void set_ranging_plan(const ftm_uplink_plan_t *plan) {
+    taskENTER_CRITICAL(&plan_mux);
+    ranging_plan = *plan;
+    taskEXIT_CRITICAL(&plan_mux);
+    xEventGroupSetBits(ftm_event_group, PLAN_RECEIVED_BIT);
+}
 
 static void mqtt_event_handler(void *handler_args, esp_event_base_t base, int32_t event_id, void *event_data) {
     esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)event_data;
     switch (event_id) {
         case MQTT_EVENT_CONNECTED:
             ESP_LOGI(TAG, "MQTT conectado");
+#if PLAN_MEDIDAS && !MODO_CALIBRACION
+            // el plan está retenido: llega en cuanto se suscribe
+            esp_mqtt_client_subscribe(mqtt_client, plan_topic, 1);
+#endif
             break;
         case MQTT_EVENT_DISCONNECTED:
             ESP_LOGI(TAG, "MQTT desconectado");
             break;
+        case MQTT_EVENT_DATA: {
+            ftm_uplink_plan_t plan = {0};
+            if (event->topic_len == (int)strlen(plan_topic) && strncmp(event->topic, plan_topic, event->topic_len) == 0 &&
+                ftm_uplink_plan_from_json(event->data, event->data_len, &plan) == 0) {
+                memcpy(plan.mac_tag, mac_tag, 6);
+                set_ranging_plan(&plan);
+                ESP_LOGI(TAG, "Plan de medida recibido por MQTT: %d anchors", plan.count);
+            }
+            break;
+        }
         default:
             break;
     }
@@ -133,13 +222,177 @@ static void ftm_report_handler(void *arg, esp_event_base_t event_base, int32_t e
     }
 }
 
+#if UPLINK_ESPNOW && !MODO_CALIBRACION
+static void espnow_send_cb(const uint8_t *mac_addr, esp_now_send_status_t status) {
+    xEventGroupSetBits(ftm_event_group, status == ESP_NOW_SEND_SUCCESS ? ESPNOW_SENT_BIT : ESPNOW_FAIL_BIT);
+}
+
+// offset del reloj con las horas de la respuesta del gateway: la media de las
+// diferencias de ida y de vuelta, así que el error solo depende de la asimetría
+// entre los dos trayectos y no de lo que el gateway tarda en contestar
+static void gateway_time_sync(const ftm_uplink_plan_t *plan, int64_t received_us) {
+    int64_t sent_us = espnow_sent_us;
+    int64_t hold_us = (int64_t)(plan->tx_us - plan->rx_us);
+    int64_t rtt_us = received_us - sent_us - hold_us;
+    if (sent_us == 0 || plan->tx_us < plan->rx_us || rtt_us < 0 || rtt_us > SYNC_RTT_MAX_MS * 1000) {
+        return;
+    }
+
+    int64_t offset_us = ((int64_t)plan->rx_us - sent_us + (int64_t)plan->tx_us - received_us) / 2;
+    taskENTER_CRITICAL(&sync_mux);
+    sync_offset_ms = (offset_us + 500) / 1000;
+    sync_valid = true;
+    gateway_sync_us = received_us;
+    taskEXIT_CRITICAL(&sync_mux);
+}
+
+// el gateway difunde su respuesta a cada tag tras su ronda, con el plan y su hora;
+// solo se acepta la propia
+static void espnow_recv_cb(const esp_now_recv_info_t *info, const uint8_t *data, int len) {
+    int64_t received_us = esp_timer_get_time();
+    ftm_uplink_plan_t plan;
+    if (len <= 0 || ftm_uplink_decode_plan(data, len, &plan) != 0 || memcmp(plan.mac_tag, mac_tag, 6) != 0) {
+        return;
+    }
+
+    if (plan.flags & FTM_UPLINK_PLAN_TIME) {
+        gateway_time_sync(&plan, received_us);
+    }
+    if (plan.flags & FTM_UPLINK_PLAN_ANCHORS) {
+        set_ranging_plan(&plan);
+    } else {
+        xEventGroupSetBits(ftm_event_group, PLAN_RECEIVED_BIT);
+    }
+}
+
+// envía la ronda al gateway; el ACK de capa MAC confirma la entrega
+static esp_err_t send_round_espnow(const ftm_uplink_frame_t *frame) {
+    if (!gateway_found) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    if (!esp_now_is_peer_exist(gateway_record.bssid)) {
+        esp_now_peer_info_t peer = {
+            .channel = gateway_record.primary,
+            .ifidx = WIFI_IF_STA,
+            .encrypt = false,
+        };
+        memcpy(peer.peer_addr, gateway_record.bssid, ESP_NOW_ETH_ALEN);
+        ESP_ERROR_CHECK(esp_now_add_peer(&peer));
+    }
+
+    // sin asociación la radio sigue en el canal del último anchor medido
+    ESP_ERROR_CHECK(esp_wifi_set_channel(gateway_record.primary, WIFI_SECOND_CHAN_NONE));
+
+    uint8_t buf[ESP_NOW_MAX_DATA_LEN];
+    size_t len = ftm_uplink_encode(frame, buf, sizeof(buf));
+
+    for (int intento = 0; intento < ESPNOW_REINTENTOS; intento++) {
+        xEventGroupClearBits(ftm_event_group, ESPNOW_SENT_BIT | ESPNOW_FAIL_BIT | PLAN_RECEIVED_BIT);
+        espnow_sent_us = esp_timer_get_time();
+        if (esp_now_send(gateway_record.bssid, buf, len) != ESP_OK) {
+            continue;
+        }
+
+        EventBits_t bits = xEventGroupWaitBits(ftm_event_group, ESPNOW_SENT_BIT | ESPNOW_FAIL_BIT,
+                                               pdTRUE, pdFALSE, pdMS_TO_TICKS(100));
+        if (bits & ESPNOW_SENT_BIT) {
+            ESP_LOGI(TAG, "Ronda %u enviada por ESP-NOW a " MACSTR, frame->header.seq, MAC2STR(gateway_record.bssid));
+            // el gateway contesta nada más recibir la ronda con el plan y su hora
+            if (xEventGroupWaitBits(ftm_event_group, PLAN_RECEIVED_BIT, pdTRUE, pdFALSE,
+                                    pdMS_TO_TICKS(PLAN_ESPERA_MS)) & PLAN_RECEIVED_BIT) {
+                ESP_LOGI(TAG, "Respuesta del gateway recibida: plan de %d anchors", ranging_plan.count);
+            }
+            return ESP_OK;
+        }
+    }
+
+    ESP_LOGW(TAG, "No se pudo entregar la ronda por ESP-NOW");
+    return ESP_FAIL;
+}
+#endif
+
+static void sync_ie_cb(void *ctx, wifi_vendor_ie_type_t type, const uint8_t sa[6], const vendor_ie_data_t *vnd_ie, int rssi) {
+    static const uint8_t oui[3] = FTM_SYNC_OUI;
+    uint64_t epoch_ms;
+
+    if (memcmp(vnd_ie->vendor_oui, oui, sizeof(oui)) != 0 || vnd_ie->vendor_oui_type != FTM_SYNC_OUI_TYPE ||
+        !ftm_sync_unpack(vnd_ie->payload, vnd_ie->length - sizeof(oui) - 1, &epoch_ms)) {
+        return;
+    }
+
+    // el retraso desde que el anchor escribió el IE solo puede restar,
+    // así que la mejor estimación es el máximo de las recibidas
+    int64_t offset = (int64_t)epoch_ms - esp_timer_get_time() / 1000;
+    taskENTER_CRITICAL(&sync_mux);
+    if (offset > sync_candidate_ms) {
+        sync_candidate_ms = offset;
+    }
+    taskEXIT_CRITICAL(&sync_mux);
+}
+
+static void begin_time_sync(void) {
+    taskENTER_CRITICAL(&sync_mux);
+    sync_candidate_ms = INT64_MIN;
+    taskEXIT_CRITICAL(&sync_mux);
+}
+
+static void commit_time_sync(void) {
+    taskENTER_CRITICAL(&sync_mux);
+    // mientras sea reciente, la hora del gateway es más precisa que la del IE
+    bool gateway_recent = gateway_sync_us != 0 &&
+                          esp_timer_get_time() - gateway_sync_us < SYNC_GATEWAY_VALIDEZ_MS * 1000LL;
+    if (sync_candidate_ms != INT64_MIN && !gateway_recent) {
+        sync_offset_ms = sync_candidate_ms;
+        sync_valid = true;
+    }
+    taskEXIT_CRITICAL(&sync_mux);
+}
+
+// escaneo corto en el canal del primer anchor para leer su IE de tiempo
+static void refresh_time_sync(void) {
+    wifi_scan_config_t scan_config = {
+        .channel = anchor_info.records[0].primary,
+        .scan_type = WIFI_SCAN_TYPE_ACTIVE,
+        .scan_time.active = { .min = 30, .max = 60 },
+    };
+
+    begin_time_sync();
+    if (esp_wifi_scan_start(&scan_config, true) == ESP_OK) {
+        esp_wifi_clear_ap_list();
+    }
+    commit_time_sync();
+}
+
+// tiempo sincronizado en ms desde epoch, 0 si aún no se ha recibido ningún IE
+static uint64_t synced_time_ms(void) {
+    if (!sync_valid) {
+        return 0;
+    }
+    return esp_timer_get_time() / 1000 + sync_offset_ms;
+}
+
+static void wait_next_round(void) {
+    uint64_t now = synced_time_ms();
+    if (now == 0) {
+        vTaskDelay(pdMS_TO_TICKS(5000));
+        return;
+    }
+
+    uint64_t slot = (mac_tag[5] % RANURAS_RONDA) * (PERIODO_RONDA_MS / RANURAS_RONDA);
+    uint64_t start = ((now - slot) / PERIODO_RONDA_MS + 1) * PERIODO_RONDA_MS + slot;
+    vTaskDelay(pdMS_TO_TICKS(start - now));
+}
+
 static esp_err_t initialize_anchors(void) {
     wifi_scan_config_t scan_config = {0};
     uint16_t ap_count = 0;
     wifi_ap_record_t* ap_records = NULL;
 
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
+    begin_time_sync();
     ESP_ERROR_CHECK(esp_wifi_scan_start(&scan_config, true));
+    commit_time_sync();
     ESP_ERROR_CHECK(esp_wifi_scan_get_ap_num(&ap_count));
 
     if (ap_count == 0) {
@@ -162,10 +415,33 @@ static esp_err_t initialize_anchors(void) {
             ESP_LOGI(TAG, "Se ha encontrado un nodo FTM: " MACSTR " en canal %d", MAC2STR(ap_records[i].bssid), ap_records[i].primary);
             anchor_info.count++;
         }
+        // gateway ESP-NOW con mejor RSSI
+        if (strncmp((const char *)ap_records[i].ssid, FTM_UPLINK_SSID_PREFIX, strlen(FTM_UPLINK_SSID_PREFIX)) == 0 &&
+            (!gateway_found || ap_records[i].rssi > gateway_record.rssi)) {
+            memcpy(&gateway_record, &ap_records[i], sizeof(wifi_ap_record_t));
+            gateway_found = true;
+        }
+    }
+#if MODO_CALIBRACION
+    // en calibración solo se mide el anchor más cercano (mayor RSSI)
+    for (int i = 1; i < anchor_info.count; i++) {
+        if (anchor_info.records[i].rssi > anchor_info.records[0].rssi) {
+            memcpy(&anchor_info.records[0], &anchor_info.records[i], sizeof(wifi_ap_record_t));
+        }
+    }
+    if (anchor_info.count > 1) {
+        anchor_info.count = 1;
+    }
+    if (anchor_info.count > 0) {
+        ESP_LOGI(TAG, "Calibrando anchor " MACSTR " a %d cm", MAC2STR(anchor_info.records[0].bssid), DISTANCIA_REFERENCIA_CM);
     }
+#endif
     if (anchor_info.count > 0) {
         ESP_LOGI(TAG, "Iniciando con %d nodos anchor FTM", anchor_info.count);
     }
+    if (gateway_found) {
+        ESP_LOGI(TAG, "Gateway ESP-NOW: " MACSTR " en canal %d", MAC2STR(gateway_record.bssid), gateway_record.primary);
+    }
     free(ap_records);
     return ESP_OK;
 }
@@ -182,11 +458,51 @@ static void initialise_wifi(void) {
     ESP_ERROR_CHECK(esp_wifi_init(&cfg));
 
     ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, WIFI_EVENT_FTM_REPORT, &ftm_report_handler, NULL, NULL));
+    ESP_ERROR_CHECK(esp_wifi_set_vendor_ie_cb(sync_ie_cb, NULL));
     ESP_ERROR_CHECK(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &wifi_event_handler, NULL, NULL));
     ESP_ERROR_CHECK(esp_wifi_set_storage(WIFI_STORAGE_RAM));
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_start());
 
+#if UPLINK_ESPNOW && !MODO_CALIBRACION
+    ESP_ERROR_CHECK(esp_now_init());
+    ESP_ERROR_CHECK(esp_now_register_send_cb(espnow_send_cb));
+    ESP_ERROR_CHECK(esp_now_register_recv_cb(espnow_recv_cb));
+#endif
+}
+
+// índices de anchor_info en orden de medida: primero los del plan. Devuelve cuántos
+// se miden siempre; el resto solo hasta tener MIN_ANCLAS_RONDA anchors medidos
+static int plan_order(uint8_t order[N_MAX_ANCHORS], bool full_round) {
+    ftm_uplink_plan_t plan;
+    taskENTER_CRITICAL(&plan_mux);
+    plan = ranging_plan;
+    taskEXIT_CRITICAL(&plan_mux);
+
+    if (!PLAN_MEDIDAS || MODO_CALIBRACION || full_round || plan.count == 0) {
+        for (int i = 0; i < anchor_info.count; i++) {
+            order[i] = i;
+        }
+        return anchor_info.count;
+    }
+
+    bool in_plan[N_MAX_ANCHORS] = {0};
+    int planned = 0;
+    for (int i = 0; i < anchor_info.count; i++) {
+        for (int j = 0; j < plan.count && !in_plan[i]; j++) {
+            in_plan[i] = memcmp(anchor_info.records[i].bssid, plan.anchors[j], 6) == 0;
+        }
+        if (in_plan[i]) {
+            order[planned++] = i;
+        }
+    }
+    int n = planned;
+    for (int i = 0; i < anchor_info.count; i++) {
+        if (!in_plan[i]) {
+            order[n++] = i;
+        }
+    }
+    return planned;
 }
 
 static void ftm_session_task(void *param) {
@@ -196,12 +512,26 @@ static void ftm_session_task(void *param) {
             continue;
         }
 
-        char mqtt_buffer[1024] = "[";
+        refresh_time_sync();
+
+        char mqtt_buffer[1536] = "[";
         int json_count = 0;
 
-        for (int anchor_idx = 0; anchor_idx < anchor_info.count; anchor_idx++) {
+        ftm_uplink_frame_t uplink_frame;
+        ftm_uplink_init(&uplink_frame, mac_tag, uplink_seq++, synced_time_ms());
+
+        uint8_t order[N_MAX_ANCHORS];
+        int planned = plan_order(order, round_count++ % RONDAS_COMPLETAS == 0);
+        int measured = 0;
+        if (planned < anchor_info.count) {
+            ESP_LOGI(TAG, "Ronda con %d de %d anchors según el plan de medida", planned, anchor_info.count);
+        }
+
+        for (int k = 0; k < anchor_info.count && (k < planned || measured < MIN_ANCLAS_RONDA); k++) {
+            int anchor_idx = order[k];
             uint64_t sum_rtt = 0;
             uint64_t sum_dist = 0;
+            uint64_t sum_ts = 0;
             int valid_measurements = 0;
 
             for (int session = 0; session < SESIONES_POR_RONDA; session++) {
@@ -229,6 +559,7 @@ static void ftm_session_task(void *param) {
                         ESP_LOGI(TAG, "FTM éxito: RTT estimado - %lu ns, Distancia estimada - %lu cm", s_rtt_est, s_dist_est);
                         sum_rtt += s_rtt_est;
                         sum_dist += s_dist_est;
+                        sum_ts += synced_time_ms();
                         valid_measurements++;
                     } else if (bits & FTM_FAILURE_BIT) {
                         ESP_LOGW(TAG, "Sesión FTM fallida. Reintentando en 2 segundos...");
@@ -245,50 +576,71 @@ static void ftm_session_task(void *param) {
             }
 
             if (valid_measurements > 0) {
+                measured++;
                 uint32_t avg_rtt = sum_rtt / valid_measurements;
                 uint32_t avg_distance = sum_dist / valid_measurements;
+                // instante medio de las sesiones válidas
+                uint64_t ts_ms = sync_valid ? sum_ts / valid_measurements : 0;
 
                 ESP_LOGI(TAG, "Promedio para " MACSTR ": RTT - %lu ns, Distancia - %lu cm",
                          MAC2STR(anchor_info.records[anchor_idx].bssid),
                          avg_rtt, avg_distance);
 
-                char mac_src_str[18];
-                snprintf(mac_src_str, sizeof(mac_src_str),
-                         "%02X:%02X:%02X:%02X:%02X:%02X",
-                         mac_tag[0], mac_tag[1], mac_tag[2],
-                         mac_tag[3], mac_tag[4], mac_tag[5]);
-
-                char mac_dst_str[18];
-                snprintf(mac_dst_str, sizeof(mac_dst_str),
-                         "%02X:%02X:%02X:%02X:%02X:%02X",
-                         anchor_info.records[anchor_idx].bssid[0],
-                         anchor_info.records[anchor_idx].bssid[1],
-                         anchor_info.records[anchor_idx].bssid[2],
-                         anchor_info.records[anchor_idx].bssid[3],
-                         anchor_info.records[anchor_idx].bssid[4],
-                         anchor_info.records[anchor_idx].bssid[5]);
+                char mac_src_str[FTM_MAC_STR_LEN];
+                ftm_mac_format(mac_tag, mac_src_str);
+
+                char mac_dst_str[FTM_MAC_STR_LEN];
+                ftm_mac_format(anchor_info.records[anchor_idx].bssid, mac_dst_str);
 
                 char json_buffer[256];
+#if MODO_CALIBRACION
+                snprintf(json_buffer, sizeof(json_buffer),
+                         "{"
+                         "\"mac_src\":\"%s\","
+                         "\"mac_dst\":\"%s\","
+                         "\"distance_cm\":%.2f,"
+                         "\"rtt_ns\":%.2f,"
+                         "\"ts_ms\":%llu,"
+                         "\"seq\":%u,"
+                         "\"reference_cm\":%d,"
+                         "\"sessions\":%d"
+                         "}",
+                         mac_src_str, mac_dst_str, (double)avg_distance, (double)avg_rtt,
+                         (unsigned long long)ts_ms, (unsigned)uplink_frame.header.seq,
+                         DISTANCIA_REFERENCIA_CM, valid_measurements);
+#else
                 snprintf(json_buffer, sizeof(json_buffer),
                          "{"
                          "\"mac_src\":\"%s\","
                          "\"mac_dst\":\"%s\","
                          "\"distance_cm\":%.2f,"
-                         "\"rtt_ns\":%.2f"
+                         "\"rtt_ns\":%.2f,"
+                         "\"ts_ms\":%llu,"
+                         "\"seq\":%u"
                          "}",
-                         mac_src_str, mac_dst_str, (double)avg_distance, (double)avg_rtt);
+                         mac_src_str, mac_dst_str, (double)avg_distance, (double)avg_rtt,
+                         (unsigned long long)ts_ms, (unsigned)uplink_frame.header.seq);
+#endif
 
                 if (json_count > 0) {
                     strncat(mqtt_buffer, ",", sizeof(mqtt_buffer) - strlen(mqtt_buffer) - 1);
                 }
                 strncat(mqtt_buffer, json_buffer, sizeof(mqtt_buffer) - strlen(mqtt_buffer) - 1);
                 json_count++;
+
+                ftm_uplink_add(&uplink_frame, anchor_info.records[anchor_idx].bssid, avg_distance, avg_rtt, ts_ms);
             } else {
                 ESP_LOGW(TAG, "No se obtuvieron mediciones válidas para " MACSTR,
                          MAC2STR(anchor_info.records[anchor_idx].bssid));
             }
         }
 
+#if UPLINK_ESPNOW && !MODO_CALIBRACION
+        if (json_count > 0 && send_round_espnow(&uplink_frame) == ESP_OK) {
+            json_count = 0;
+        }
+#endif
+
         if (json_count > 0) {
             strncat(mqtt_buffer, "]", sizeof(mqtt_buffer) - strlen(mqtt_buffer) - 1);
 
@@ -299,7 +651,7 @@ static void ftm_session_task(void *param) {
 
             vTaskDelay(pdMS_TO_TICKS(2000));
 
-            int msg_id = esp_mqtt_client_publish(mqtt_client, MQTT_TOPIC, mqtt_buffer, 0, 1, 0);
+            int msg_id = esp_mqtt_client_publish(mqtt_client, MQTT_TOPIC_RONDA, mqtt_buffer, 0, 1, 0);
             if (msg_id < 0) {
                 ESP_LOGE(TAG, "Error al publicar mensaje MQTT");
             } else {
@@ -317,7 +669,7 @@ static void ftm_session_task(void *param) {
             mqtt_buffer[0] = '[';
         }
 
-        vTaskDelay(pdMS_TO_TICKS(5000));
+        wait_next_round();
     }
 }
 
@@ -330,8 +682,14 @@ void app_main(void) {
     ESP_ERROR_CHECK(ret);
 
     ESP_ERROR_CHECK(esp_read_mac(mac_tag, ESP_MAC_WIFI_STA));
+    char mac_tag_str[FTM_MAC_STR_LEN];
+    ftm_mac_format(mac_tag, mac_tag_str);
+    snprintf(plan_topic, sizeof(plan_topic), MQTT_TOPIC_PLAN "%s", mac_tag_str);
     initialise_wifi();
     esp_log_level_set("wifi", ESP_LOG_INFO);
+    // con la radio ya activa esp_random es aleatorio: tras un reinicio el tag no
+    // repite los números de ronda recientes, que el servidor usa para descartar duplicados
+    uplink_seq = (uint16_t)esp_random();
 
 
     if (initialize_anchors() != ESP_OK) {
@@ -339,6 +697,6 @@ void app_main(void) {
         return;
     }
 
-    xTaskCreate(ftm_session_task, "FTM Session Task", 4096, NULL, configMAX_PRIORITIES - 1, NULL);
+    xTaskCreate(ftm_session_task, "FTM Session Task", 6144, NULL, configMAX_PRIORITIES - 1, NULL);
 }
 
@@ -0,0 +1,100 @@
+#include "batcher.hpp"
+
+std::vector<Batch> Batch::split() const
+{
+    std::vector<Batch> singles(seqs.size());
+    size_t anchors_begin = 0;
+    size_t measurements_begin = 0;
+    for (size_t i = 0; i < seqs.size(); ++i) {
+        Batch &single = singles[i];
+        single.anchors.assign(anchors.begin() + anchors_begin, anchors.begin() + anchors_end[i]);
+        single.measurements.assign(measurements.begin() + measurements_begin,
+                                   measurements.begin() + measurements_end[i]);
+        single.received.push_back(received[i]);
+        single.seqs.push_back(seqs[i]);
+        single.anchors_end.push_back(single.anchors.size());
+        single.measurements_end.push_back(single.measurements.size());
+        anchors_begin = anchors_end[i];
+        measurements_begin = measurements_end[i];
+    }
+    return singles;
+}
+
+Batcher::Batcher(size_t max_rows, std::chrono::milliseconds max_age, size_t max_pending_rows)
+    : max_rows_(max_rows), max_age_(max_age), max_pending_rows_(max_pending_rows)
+{
+}
+
+void Batcher::push(Message &&message)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_.wait(lock, [this] { return closed_ || pending_rows_ < max_pending_rows_; });
+
+    if (current_.empty()) {
+        current_started_ = Clock::now();
+    }
+    pending_rows_ += message.rows();
+    current_.received.push_back(message.received);
+    current_.seqs.push_back(message.seq);
+    for (auto &row : message.anchors) {
+        current_.anchors.push_back(std::move(row));
+    }
+    for (auto &row : message.measurements) {
+        current_.measurements.push_back(std::move(row));
+    }
+    current_.anchors_end.push_back(current_.anchors.size());
+    current_.measurements_end.push_back(current_.measurements.size());
+
+    if (current_.rows() >= max_rows_) {
+        seal();
+        ready_.notify_one();
+    } else if (current_.received.size() == 1) {
+        // hay un escritor esperando sin plazo: que empiece a contar la antigüedad
+        ready_.notify_one();
+    }
+}
+
+void Batcher::seal()
+{
+    sealed_.push_back(std::move(current_));
+    current_ = Batch();
+}
+
+bool Batcher::pop(Batch &batch)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        if (sealed_.empty() && !current_.empty() &&
+            (closed_ || Clock::now() >= current_started_ + max_age_)) {
+            seal();
+        }
+
+        if (!sealed_.empty()) {
+            batch = std::move(sealed_.front());
+            sealed_.pop_front();
+            pending_rows_ -= batch.rows();
+            space_.notify_all();
+            return true;
+        }
+
+        if (closed_) {
+            return false;
+        }
+
+        if (current_.empty()) {
+            ready_.wait(lock);
+        } else {
+            ready_.wait_until(lock, current_started_ + max_age_);
+        }
+    }
+}
+
+void Batcher::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    ready_.notify_all();
+    space_.notify_all();
+}
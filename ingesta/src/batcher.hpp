@@ -0,0 +1,55 @@
+#pragma once
+
+#include "payload.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+// filas de varios mensajes que se escriben juntas en una transacción
+struct Batch {
+    std::vector<AnchorRow> anchors;
+    std::vector<MeasurementRow> measurements;
+    std::vector<Clock::time_point> received;   // una por mensaje, para la latencia de ingesta
+    std::vector<uint64_t> seqs;                // una por mensaje, secuencias del spool
+    std::vector<size_t> anchors_end;           // una por mensaje, fin de sus filas en anchors
+    std::vector<size_t> measurements_end;      // una por mensaje, fin de sus filas en measurements
+
+    size_t rows() const { return anchors.size() + measurements.size(); }
+    bool empty() const { return rows() == 0; }
+
+    // un lote por mensaje, para aislar el que PostgreSQL rechaza
+    std::vector<Batch> split() const;
+};
+
+// agrupa los mensajes en lotes que se cierran por tamaño o por antigüedad y
+// reparte los lotes cerrados entre los escritores
+class Batcher {
+public:
+    Batcher(size_t max_rows, std::chrono::milliseconds max_age, size_t max_pending_rows);
+
+    // bloquea mientras haya demasiadas filas esperando a los escritores
+    void push(Message &&message);
+
+    // espera al siguiente lote; false cuando se ha cerrado y no queda nada
+    bool pop(Batch &batch);
+
+    void close();
+
+private:
+    void seal();
+
+    const size_t max_rows_;
+    const std::chrono::milliseconds max_age_;
+    const size_t max_pending_rows_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::condition_variable space_;
+    Batch current_;
+    Clock::time_point current_started_;
+    std::deque<Batch> sealed_;
+    size_t pending_rows_ = 0;
+    bool closed_ = false;
+};
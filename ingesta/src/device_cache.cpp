@@ -0,0 +1,91 @@
+#include "device_cache.hpp"
+
+#include <cstdlib>
+#include <mutex>
+
+std::optional<int32_t> DeviceCache::find(MacKey mac) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(mac);
+    if (it == ids_.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    return it->second;
+}
+
+uint64_t DeviceCache::generation() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return generation_;
+}
+
+void DeviceCache::put(const std::map<MacKey, int32_t> &ids, uint64_t generation)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (generation != generation_) {
+        return;
+    }
+    for (const auto &[mac, id] : ids) {
+        ids_[mac] = id;
+    }
+}
+
+void DeviceCache::replace(std::unordered_map<MacKey, int32_t> ids)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    ids_ = std::move(ids);
+    ++generation_;
+}
+
+void DeviceCache::clear()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    ids_.clear();
+    ++generation_;
+}
+
+void DeviceCache::apply(std::string_view notification)
+{
+    // "INSERT id mac", "DELETE id mac" o "TRUNCATE"
+    size_t first = notification.find(' ');
+    std::string_view op = notification.substr(0, first);
+    if (op == "TRUNCATE" || first == std::string_view::npos) {
+        clear();
+        return;
+    }
+    size_t second = notification.find(' ', first + 1);
+    if (second == std::string_view::npos) {
+        clear();
+        return;
+    }
+    int32_t id = static_cast<int32_t>(std::strtol(std::string(notification.substr(first + 1, second - first - 1)).c_str(), nullptr, 10));
+    std::optional<MacKey> mac = parse_mac(notification.substr(second + 1));
+    if (!mac) {
+        clear();
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (op == "INSERT") {
+        ids_[*mac] = id;
+    } else {
+        ids_.erase(*mac);
+        ++generation_;
+    }
+}
+
+size_t DeviceCache::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return ids_.size();
+}
+
+std::string DeviceCache::take_stats()
+{
+    uint64_t hits = hits_.exchange(0);
+    uint64_t misses = misses_.exchange(0);
+    return "caché de dispositivos " + std::to_string(size()) + " MAC, " + std::to_string(hits) +
+           " aciertos, " + std::to_string(misses) + " fallos";
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "payload.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// mapa mac -> devices.id compartido por los escritores. Se llena al arrancar
+// y con las altas de la propia ingesta, y se invalida con las notificaciones
+// del canal devices_changed (ver notify_devices_changed en el esquema).
+class DeviceCache {
+public:
+    std::optional<int32_t> find(MacKey mac) const;
+
+    // las invalidaciones incrementan la generación; put() descarta los ids
+    // leídos antes de una invalidación porque pueden estar obsoletos
+    uint64_t generation() const;
+    void put(const std::map<MacKey, int32_t> &ids, uint64_t generation);
+
+    void replace(std::unordered_map<MacKey, int32_t> ids);
+    void clear();
+
+    // aplica una notificación de devices_changed
+    void apply(std::string_view notification);
+
+    size_t size() const;
+
+    // aciertos y fallos desde la última llamada, para el informe de métricas
+    std::string take_stats();
+
+private:
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<MacKey, int32_t> ids_;
+    uint64_t generation_ = 0;
+    mutable std::atomic<uint64_t> hits_{0};
+    mutable std::atomic<uint64_t> misses_{0};
+};
@@ -0,0 +1,90 @@
+#include "device_listener.hpp"
+
+#include "log.hpp"
+
+#include <libpq-fe.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <poll.h>
+
+namespace {
+
+constexpr int POLL_MS = 1000;
+
+using Connection = std::unique_ptr<PGconn, decltype(&PQfinish)>;
+
+}  // namespace
+
+DeviceListener::DeviceListener(std::string conninfo, DeviceCache &cache)
+    : conninfo_(std::move(conninfo)), cache_(cache)
+{
+}
+
+void DeviceListener::run(const std::atomic<bool> &stop)
+{
+    int backoff_s = 1;
+    while (!stop) {
+        try {
+            wait_notifications(stop);
+            backoff_s = 1;
+        } catch (const std::exception &e) {
+            cache_.clear();
+            log(std::string("Caché de dispositivos sin notificaciones: ") + e.what());
+        }
+
+        for (int i = 0; i < backoff_s * 10 && !stop; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        backoff_s = std::min(backoff_s * 2, 30);
+    }
+}
+
+void DeviceListener::wait_notifications(const std::atomic<bool> &stop)
+{
+    Connection conn(PQconnectdb(conninfo_.c_str()), &PQfinish);
+    if (PQstatus(conn.get()) != CONNECTION_OK) {
+        throw std::runtime_error(PQerrorMessage(conn.get()));
+    }
+
+    // LISTEN antes de leer la tabla: un cambio entre ambos llega como notificación
+    PGresult *result = PQexec(conn.get(), "LISTEN devices_changed");
+    bool ok = PQresultStatus(result) == PGRES_COMMAND_OK;
+    PQclear(result);
+    if (!ok) {
+        throw std::runtime_error(PQerrorMessage(conn.get()));
+    }
+
+    result = PQexec(conn.get(), "SELECT id, mac FROM devices WHERE mac IS NOT NULL");
+    if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+        PQclear(result);
+        throw std::runtime_error(PQerrorMessage(conn.get()));
+    }
+    std::unordered_map<MacKey, int32_t> ids;
+    for (int i = 0; i < PQntuples(result); ++i) {
+        if (std::optional<MacKey> mac = parse_mac(PQgetvalue(result, i, 1))) {
+            ids[*mac] = static_cast<int32_t>(std::stol(PQgetvalue(result, i, 0)));
+        }
+    }
+    PQclear(result);
+    cache_.replace(std::move(ids));
+    log("Caché de dispositivos cargada: " + std::to_string(cache_.size()) + " dispositivos");
+
+    while (!stop) {
+        pollfd pfd{PQsocket(conn.get()), POLLIN, 0};
+        if (poll(&pfd, 1, POLL_MS) <= 0) {
+            continue;
+        }
+        if (!PQconsumeInput(conn.get())) {
+            throw std::runtime_error(PQerrorMessage(conn.get()));
+        }
+        while (PGnotify *notify = PQnotifies(conn.get())) {
+            cache_.apply(notify->extra);
+            PQfreemem(notify);
+        }
+    }
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "device_cache.hpp"
+
+#include <atomic>
+#include <string>
+
+// conexión dedicada a LISTEN devices_changed: llena la caché al conectar y le
+// aplica los cambios de devices hechos por cualquier cliente. Si se pierde la
+// conexión la caché se vacía, porque se pueden haber perdido notificaciones.
+class DeviceListener {
+public:
+    DeviceListener(std::string conninfo, DeviceCache &cache);
+
+    void run(const std::atomic<bool> &stop);
+
+private:
+    void wait_notifications(const std::atomic<bool> &stop);
+
+    std::string conninfo_;
+    DeviceCache &cache_;
+};
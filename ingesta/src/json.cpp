@@ -0,0 +1,243 @@
+#include "json.hpp"
+
+#include <cstdlib>
+#include <stdexcept>
+
+namespace json {
+
+namespace {
+
+constexpr int MAX_DEPTH = 32;
+
+class Parser {
+public:
+    explicit Parser(std::string_view text) : text_(text) {}
+
+    Value parse_document()
+    {
+        Value value = parse_value(0);
+        skip_spaces();
+        if (pos_ != text_.size()) {
+            fail("contenido tras el final del documento");
+        }
+        return value;
+    }
+
+private:
+    [[noreturn]] void fail(const char *what) const
+    {
+        throw std::runtime_error(std::string("JSON no válido: ") + what + " (posición " + std::to_string(pos_) + ")");
+    }
+
+    void skip_spaces()
+    {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c)
+    {
+        skip_spaces();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!consume(c)) {
+            fail("carácter inesperado");
+        }
+    }
+
+    bool consume_literal(std::string_view literal)
+    {
+        if (text_.substr(pos_, literal.size()) == literal) {
+            pos_ += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    Value parse_value(int depth)
+    {
+        if (depth > MAX_DEPTH) {
+            fail("anidamiento demasiado profundo");
+        }
+        skip_spaces();
+        if (pos_ >= text_.size()) {
+            fail("fin inesperado");
+        }
+
+        Value value;
+        char c = text_[pos_];
+        if (c == '{') {
+            ++pos_;
+            value.type = Value::Type::Object;
+            if (consume('}')) {
+                return value;
+            }
+            do {
+                skip_spaces();
+                std::string key = parse_string();
+                expect(':');
+                value.members.emplace_back(std::move(key), parse_value(depth + 1));
+            } while (consume(','));
+            expect('}');
+        } else if (c == '[') {
+            ++pos_;
+            value.type = Value::Type::Array;
+            if (consume(']')) {
+                return value;
+            }
+            do {
+                value.items.push_back(parse_value(depth + 1));
+            } while (consume(','));
+            expect(']');
+        } else if (c == '"') {
+            value.type = Value::Type::String;
+            value.string = parse_string();
+        } else if (consume_literal("true")) {
+            value.type = Value::Type::Bool;
+            value.boolean = true;
+        } else if (consume_literal("false")) {
+            value.type = Value::Type::Bool;
+        } else if (consume_literal("null")) {
+            value.type = Value::Type::Null;
+        } else {
+            value.type = Value::Type::Number;
+            value.number = parse_number();
+        }
+        return value;
+    }
+
+    double parse_number()
+    {
+        size_t start = pos_;
+        while (pos_ < text_.size() && std::string_view("+-0123456789.eE").find(text_[pos_]) != std::string_view::npos) {
+            ++pos_;
+        }
+        if (start == pos_) {
+            fail("valor desconocido");
+        }
+
+        std::string token(text_.substr(start, pos_ - start));
+        char *end = nullptr;
+        double number = std::strtod(token.c_str(), &end);
+        if (end != token.c_str() + token.size()) {
+            fail("número mal formado");
+        }
+        return number;
+    }
+
+    unsigned parse_hex4()
+    {
+        if (pos_ + 4 > text_.size()) {
+            fail("secuencia \\u incompleta");
+        }
+        unsigned code = 0;
+        for (int i = 0; i < 4; ++i) {
+            char h = text_[pos_++];
+            code <<= 4;
+            if (h >= '0' && h <= '9') code |= h - '0';
+            else if (h >= 'a' && h <= 'f') code |= h - 'a' + 10;
+            else if (h >= 'A' && h <= 'F') code |= h - 'A' + 10;
+            else fail("secuencia \\u no válida");
+        }
+        return code;
+    }
+
+    static void append_utf8(std::string &out, unsigned code)
+    {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    std::string parse_string()
+    {
+        if (pos_ >= text_.size() || text_[pos_] != '"') {
+            fail("se esperaba una cadena");
+        }
+        ++pos_;
+
+        std::string out;
+        while (pos_ < text_.size()) {
+            char c = text_[pos_++];
+            if (c == '"') {
+                return out;
+            }
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                break;
+            }
+            switch (text_[pos_++]) {
+            case '"': out += '"'; break;
+            case '\\': out += '\\'; break;
+            case '/': out += '/'; break;
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            case 'u': {
+                unsigned code = parse_hex4();
+                // pareja sustituta UTF-16
+                if (code >= 0xD800 && code < 0xDC00 && consume_literal("\\u")) {
+                    unsigned low = parse_hex4();
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        fail("pareja sustituta no válida");
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                }
+                append_utf8(out, code);
+                break;
+            }
+            default:
+                fail("escape no válido");
+            }
+        }
+        fail("cadena sin cerrar");
+    }
+
+    std::string_view text_;
+    size_t pos_ = 0;
+};
+
+}  // namespace
+
+const Value *Value::find(std::string_view key) const
+{
+    for (const auto &[name, value] : members) {
+        if (name == key) {
+            return value.type == Type::Null ? nullptr : &value;
+        }
+    }
+    return nullptr;
+}
+
+Value parse(std::string_view text)
+{
+    return Parser(text).parse_document();
+}
+
+}  // namespace json
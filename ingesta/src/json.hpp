@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// lector JSON mínimo para los mensajes de los nodos (arrays de objetos planos)
+namespace json {
+
+struct Value {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<Value> items;
+    std::vector<std::pair<std::string, Value>> members;
+
+    bool is_number() const { return type == Type::Number; }
+    bool is_string() const { return type == Type::String; }
+    bool is_array() const { return type == Type::Array; }
+    bool is_object() const { return type == Type::Object; }
+
+    // miembro de un objeto, nullptr si no existe o es null
+    const Value *find(std::string_view key) const;
+};
+
+// lanza std::runtime_error si el texto no es JSON válido
+Value parse(std::string_view text);
+
+}  // namespace json
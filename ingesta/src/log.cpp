@@ -0,0 +1,23 @@
+#include "log.hpp"
+
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+
+namespace {
+
+std::mutex g_log_mutex;
+
+}  // namespace
+
+void log(const std::string &text)
+{
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::tm local;
+    localtime_r(&now, &local);
+    std::strftime(stamp, sizeof(stamp), "%F %T", &local);
+    std::lock_guard<std::mutex> lock(g_log_mutex);
+    std::printf("[%s] %s\n", stamp, text.c_str());
+    std::fflush(stdout);
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include <string>
+
+// línea con fecha y hora en la salida estándar, segura entre hilos
+void log(const std::string &text);
@@ -0,0 +1,316 @@
+// ftm_ingesta: ingesta de los mensajes del topic de datos en PostgreSQL.
+// Alternativa al flujo de Node-RED: guarda cada mensaje en un spool local
+// antes de confirmarlo al broker y agrupa las filas de muchos mensajes en
+// lotes que se escriben con COPY binario desde un pool de conexiones.
+
+#include "batcher.hpp"
+#include "device_cache.hpp"
+#include "device_listener.hpp"
+#include "log.hpp"
+#include "metrics.hpp"
+#include "mqtt_client.hpp"
+#include "payload.hpp"
+#include "pg_writer.hpp"
+#include "spool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string mqtt_host = "localhost";
+    uint16_t mqtt_port = 1884;
+    std::string topic = "data";
+    std::string client_id = "ftm-ingesta";
+    uint16_t keepalive_s = 30;
+    std::string conninfo = "dbname=postgres2 user=postgres password=lucia host=127.0.0.1 port=5432";
+    int writers = 2;
+    size_t batch_rows = 1000;
+    int batch_ms = 200;
+    size_t max_pending_rows = 100000;
+    int report_s = 10;
+    std::string spool_dir = "spool";
+    size_t spool_segment_mb = 64;
+};
+
+std::atomic<bool> g_stop{false};
+
+void on_signal(int)
+{
+    g_stop = true;
+}
+
+// espera interrumpible por la señal de parada
+void sleep_unless_stopped(std::chrono::milliseconds duration)
+{
+    auto deadline = Clock::now() + duration;
+    while (!g_stop && Clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+void usage(const char *program)
+{
+    std::printf(
+        "uso: %s [opciones]\n"
+        "  --mqtt-host HOST      broker MQTT (localhost)\n"
+        "  --mqtt-port PUERTO    puerto del broker (1884)\n"
+        "  --topic TOPIC         topic de datos (data)\n"
+        "  --client-id ID        client ID con sesión persistente (ftm-ingesta)\n"
+        "  --db CONNINFO         conexión a PostgreSQL (postgres2 en 127.0.0.1)\n"
+        "  --writers N           conexiones del pool (2)\n"
+        "  --batch-rows N        filas por lote (1000)\n"
+        "  --batch-ms MS         antigüedad máxima de un lote (200)\n"
+        "  --report-s S          periodo del informe de métricas (10)\n"
+        "  --spool-dir DIR       directorio del spool local (spool)\n"
+        "  --spool-segment-mb N  tamaño de cada segmento del spool (64)\n",
+        program);
+}
+
+Options parse_options(int argc, char **argv)
+{
+    static const option long_options[] = {
+        {"mqtt-host", required_argument, nullptr, 'h'},
+        {"mqtt-port", required_argument, nullptr, 'p'},
+        {"topic", required_argument, nullptr, 't'},
+        {"client-id", required_argument, nullptr, 'i'},
+        {"db", required_argument, nullptr, 'd'},
+        {"writers", required_argument, nullptr, 'w'},
+        {"batch-rows", required_argument, nullptr, 'r'},
+        {"batch-ms", required_argument, nullptr, 'm'},
+        {"report-s", required_argument, nullptr, 's'},
+        {"spool-dir", required_argument, nullptr, 'D'},
+        {"spool-segment-mb", required_argument, nullptr, 'S'},
+        {"help", no_argument, nullptr, 'H'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    Options options;
+    int c;
+    while ((c = getopt_long(argc, argv, "", long_options, nullptr)) != -1) {
+        switch (c) {
+        case 'h': options.mqtt_host = optarg; break;
+        case 'p': options.mqtt_port = static_cast<uint16_t>(std::atoi(optarg)); break;
+        case 't': options.topic = optarg; break;
+        case 'i': options.client_id = optarg; break;
+        case 'd': options.conninfo = optarg; break;
+        case 'w': options.writers = std::max(1, std::atoi(optarg)); break;
+        case 'r': options.batch_rows = std::max(1, std::atoi(optarg)); break;
+        case 'm': options.batch_ms = std::max(1, std::atoi(optarg)); break;
+        case 's': options.report_s = std::max(1, std::atoi(optarg)); break;
+        case 'D': options.spool_dir = optarg; break;
+        case 'S': options.spool_segment_mb = std::max(1, std::atoi(optarg)); break;
+        default:
+            usage(argv[0]);
+            std::exit(c == 'H' ? 0 : 1);
+        }
+    }
+    options.max_pending_rows = std::max(options.max_pending_rows, options.batch_rows * options.writers * 4);
+    return options;
+}
+
+enum class WriteResult { written, rejected, stopped };
+
+// escribe un lote reintentando los errores de conexión; durante la parada solo
+// unas pocas veces, y el lote se vuelve a leer del spool al arrancar. Si
+// PostgreSQL rechaza los datos devuelve rejected con el error en error
+WriteResult write_batch(PgWriter &writer, const Batch &batch, std::string &error)
+{
+    for (int attempt = 0;; ++attempt) {
+        try {
+            writer.write(batch);
+            return WriteResult::written;
+        } catch (const PgError &e) {
+            if (!e.retryable) {
+                error = e.what();
+                return WriteResult::rejected;
+            }
+            if (g_stop && attempt >= 3) {
+                log(std::string("Lote de ") + std::to_string(batch.rows()) +
+                    " filas sin escribir, queda en el spool: " + e.what());
+                return WriteResult::stopped;
+            }
+            log(std::string("Error escribiendo el lote, se reintenta: ") + e.what());
+            std::this_thread::sleep_for(std::chrono::milliseconds(std::min(200 << std::min(attempt, 5), 5000)));
+        }
+    }
+}
+
+// hilo del pool: escribe lotes hasta que se cierra el batcher
+void writer_loop(const Options &options, Batcher &batcher, Metrics &metrics, DeviceCache &cache, Spool &spool)
+{
+    PgWriter writer(options.conninfo, cache, spool.id());
+    Batch batch;
+    std::string error;
+
+    while (batcher.pop(batch)) {
+        WriteResult result = write_batch(writer, batch, error);
+        if (result == WriteResult::written) {
+            metrics.batch_written(batch);
+            spool.done(batch.seqs);
+        } else if (result == WriteResult::rejected) {
+            // los mensajes ya confirmados al broker solo están en el spool: se
+            // reescriben uno a uno y se descarta solo el que falla por sí mismo
+            if (batch.seqs.size() > 1) {
+                log(std::string("Lote de ") + std::to_string(batch.seqs.size()) +
+                    " mensajes rechazado, se escribe mensaje a mensaje: " + error);
+            }
+            for (const Batch &single : batch.split()) {
+                if (batch.seqs.size() > 1) {
+                    result = write_batch(writer, single, error);
+                }
+                if (result == WriteResult::written) {
+                    metrics.batch_written(single);
+                    spool.done(single.seqs);
+                } else if (result == WriteResult::rejected) {
+                    log(std::string("Mensaje descartado: ") + error);
+                    metrics.message_rejected();
+                    metrics.batch_dropped(single);
+                    spool.done(single.seqs);
+                } else {
+                    break;
+                }
+            }
+        }
+
+        if (std::optional<uint64_t> watermark = spool.take_compaction()) {
+            try {
+                writer.compact_spooled(*watermark);
+            } catch (const PgError &e) {
+                log(std::string("Error compactando ingest_spool: ") + e.what());
+            }
+        }
+    }
+}
+
+// drenador: pasa los mensajes del spool al batcher, empezando por los que
+// quedaron sin escribir en la ejecución anterior
+void drain_loop(const Options &options, Spool &spool, Batcher &batcher, Metrics &metrics, DeviceCache &cache)
+{
+    // sin saber qué está ya en PostgreSQL no se puede reproducir sin duplicar
+    for (int backoff_s = 1; !g_stop; backoff_s = std::min(backoff_s * 2, 30)) {
+        try {
+            PgWriter writer(options.conninfo, cache, spool.id());
+            spool.load_committed(writer.spooled_ranges());
+            break;
+        } catch (const PgError &e) {
+            log(std::string("No se puede leer ingest_spool, se reintenta: ") + e.what());
+            sleep_unless_stopped(std::chrono::seconds(backoff_s));
+        }
+    }
+
+    Spool::Record record;
+    while (spool.next(record)) {
+        if (spool.is_done(record.seq)) {
+            continue;
+        }
+        try {
+            Message message = parse_message(record.payload);
+            message.received = Clock::now();
+            message.seq = record.seq;
+            batcher.push(std::move(message));
+        } catch (const std::exception &e) {
+            metrics.message_rejected();
+            spool.done({record.seq});
+            log(std::string("Mensaje descartado: ") + e.what());
+        }
+    }
+}
+
+void report_loop(const Options &options, Metrics &metrics, DeviceCache &cache, Spool &spool)
+{
+    while (!g_stop) {
+        sleep_unless_stopped(std::chrono::seconds(options.report_s));
+        if (!g_stop) {
+            log(metrics.report() + "; " + cache.take_stats() + "; " + spool.take_stats());
+        }
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv)
+{
+    Options options = parse_options(argc, argv);
+
+    struct sigaction action {};
+    action.sa_handler = on_signal;
+    sigaction(SIGINT, &action, nullptr);
+    sigaction(SIGTERM, &action, nullptr);
+
+    std::unique_ptr<Spool> spool_ptr;
+    try {
+        spool_ptr = std::make_unique<Spool>(options.spool_dir, options.spool_segment_mb << 20);
+    } catch (const std::exception &e) {
+        log(e.what());
+        return 1;
+    }
+    Spool &spool = *spool_ptr;
+
+    Metrics metrics;
+    DeviceCache cache;
+    DeviceListener listener(options.conninfo, cache);
+    std::thread listener_thread(&DeviceListener::run, &listener, std::cref(g_stop));
+
+    Batcher batcher(options.batch_rows, std::chrono::milliseconds(options.batch_ms), options.max_pending_rows);
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < options.writers; ++i) {
+        writers.emplace_back(writer_loop, std::cref(options), std::ref(batcher), std::ref(metrics), std::ref(cache),
+                             std::ref(spool));
+    }
+    std::thread drainer(drain_loop, std::cref(options), std::ref(spool), std::ref(batcher), std::ref(metrics),
+                        std::ref(cache));
+    std::thread reporter(report_loop, std::cref(options), std::ref(metrics), std::ref(cache), std::ref(spool));
+
+    // el hilo MQTT solo guarda en el spool; el broker recibe el PUBACK tras el fsync
+    MqttClient client(options.mqtt_host, options.mqtt_port, options.client_id, options.keepalive_s);
+    auto handler = [&](std::string_view, std::string_view payload) {
+        metrics.message_received();
+        spool.append(payload);
+    };
+    auto flush = [&] { spool.sync(); };
+
+    int backoff_s = 1;
+    while (!g_stop) {
+        try {
+            // sesión persistente: el broker guarda los mensajes QoS 1 mientras la ingesta está parada
+            client.connect(false);
+            client.subscribe(options.topic, 1);
+            log("Conectado a " + options.mqtt_host + ":" + std::to_string(options.mqtt_port) +
+                ", suscrito a " + options.topic);
+            backoff_s = 1;
+            client.run(g_stop, handler, flush);
+        } catch (const std::exception &e) {
+            log(std::string("Conexión MQTT perdida: ") + e.what());
+        }
+        // sin PUBACK el broker vuelve a enviar lo no sincronizado: guardarlo
+        // ahora lo duplicaría con el reenvío
+        spool.discard_pending();
+        client.disconnect();
+        sleep_unless_stopped(std::chrono::seconds(backoff_s));
+        backoff_s = std::min(backoff_s * 2, 30);
+    }
+
+    log("Parando: se escriben los lotes pendientes");
+    spool.close();
+    drainer.join();
+    batcher.close();
+    for (std::thread &writer : writers) {
+        writer.join();
+    }
+    reporter.join();
+    listener_thread.join();
+    log(metrics.report() + "; " + cache.take_stats() + "; " + spool.take_stats());
+    return 0;
+}
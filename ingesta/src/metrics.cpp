@@ -0,0 +1,101 @@
+#include "metrics.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace {
+
+// muestras de latencia guardadas por intervalo de informe
+constexpr size_t MAX_SAMPLES = 100000;
+
+void add_sample(std::vector<double> &samples, double value)
+{
+    if (samples.size() < MAX_SAMPLES) {
+        samples.push_back(value);
+    }
+}
+
+double percentile(std::vector<double> &samples, double p)
+{
+    size_t k = static_cast<size_t>(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + k, samples.end());
+    return samples[k];
+}
+
+std::string describe(std::vector<double> &samples)
+{
+    if (samples.empty()) {
+        return "sin datos";
+    }
+    char text[96];
+    std::snprintf(text, sizeof(text), "p50 %.0f ms, p99 %.0f ms, max %.0f ms",
+                  percentile(samples, 0.5), percentile(samples, 0.99),
+                  *std::max_element(samples.begin(), samples.end()));
+    return text;
+}
+
+}  // namespace
+
+void Metrics::message_received()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++messages_;
+}
+
+void Metrics::message_rejected()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++rejected_;
+}
+
+void Metrics::batch_written(const Batch &batch)
+{
+    auto committed = Clock::now();
+    int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++batches_;
+    rows_ += batch.rows();
+    max_batch_ = std::max(max_batch_, batch.rows());
+    for (const auto &received : batch.received) {
+        add_sample(ingest_lag_ms_, std::chrono::duration<double, std::milli>(committed - received).count());
+    }
+    for (const auto &row : batch.measurements) {
+        if (row.ts_ms) {
+            add_sample(e2e_lag_ms_, static_cast<double>(now_ms - *row.ts_ms));
+        }
+    }
+}
+
+void Metrics::batch_dropped(const Batch &batch)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropped_rows_ += batch.rows();
+}
+
+std::string Metrics::report()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    double seconds = std::max(std::chrono::duration<double>(now - last_report_).count(), 1e-3);
+
+    char text[256];
+    std::snprintf(text, sizeof(text),
+                  "%.1f msg/s, %.1f filas/s, %llu lotes (media %.1f, max %zu filas), "
+                  "%llu mensajes rechazados, %llu filas descartadas",
+                  messages_ / seconds, rows_ / seconds, static_cast<unsigned long long>(batches_),
+                  batches_ ? static_cast<double>(rows_) / batches_ : 0.0, max_batch_,
+                  static_cast<unsigned long long>(rejected_), static_cast<unsigned long long>(dropped_rows_));
+
+    std::string out = text;
+    out += "; latencia de ingesta " + describe(ingest_lag_ms_);
+    out += "; latencia extremo a extremo " + describe(e2e_lag_ms_);
+
+    last_report_ = now;
+    messages_ = rejected_ = rows_ = batches_ = dropped_rows_ = 0;
+    max_batch_ = 0;
+    ingest_lag_ms_.clear();
+    e2e_lag_ms_.clear();
+    return out;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "batcher.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// contadores de la ingesta; report() resume el intervalo desde el último informe
+class Metrics {
+public:
+    void message_received();
+    void message_rejected();
+    void batch_written(const Batch &batch);
+    void batch_dropped(const Batch &batch);
+
+    std::string report();
+
+private:
+    std::mutex mutex_;
+    Clock::time_point last_report_ = Clock::now();
+    uint64_t messages_ = 0;
+    uint64_t rejected_ = 0;
+    uint64_t rows_ = 0;
+    uint64_t batches_ = 0;
+    uint64_t dropped_rows_ = 0;
+    size_t max_batch_ = 0;
+    std::vector<double> ingest_lag_ms_;   // recepción MQTT -> commit
+    std::vector<double> e2e_lag_ms_;      // ts_ms del tag -> commit
+};
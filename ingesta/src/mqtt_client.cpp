@@ -0,0 +1,333 @@
+#include "mqtt_client.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint8_t CONNECT = 0x10;
+constexpr uint8_t SUBSCRIBE = 0x82;
+constexpr uint8_t PUBACK = 0x40;
+constexpr uint8_t PUBREC = 0x50;
+constexpr uint8_t PUBCOMP = 0x70;
+constexpr uint8_t PINGREQ = 0xC0;
+constexpr uint8_t DISCONNECT = 0xE0;
+
+constexpr uint8_t TYPE_CONNACK = 2;
+constexpr uint8_t TYPE_PUBLISH = 3;
+constexpr uint8_t TYPE_PUBREL = 6;
+constexpr uint8_t TYPE_SUBACK = 9;
+
+constexpr int CONNACK_TIMEOUT_MS = 10000;
+constexpr int POLL_MS = 1000;
+
+// límites del grupo de mensajes confirmados con un solo flush
+constexpr size_t MAX_UNACKED = 256;
+constexpr auto MAX_ACK_DELAY = std::chrono::milliseconds(20);
+
+void put_u16(std::string &out, uint16_t value)
+{
+    out += static_cast<char>(value >> 8);
+    out += static_cast<char>(value & 0xFF);
+}
+
+void put_string(std::string &out, std::string_view value)
+{
+    put_u16(out, static_cast<uint16_t>(value.size()));
+    out.append(value);
+}
+
+uint16_t get_u16(const std::string &in, size_t pos)
+{
+    if (pos + 2 > in.size()) {
+        throw std::runtime_error("paquete MQTT truncado");
+    }
+    return static_cast<uint16_t>((static_cast<uint8_t>(in[pos]) << 8) | static_cast<uint8_t>(in[pos + 1]));
+}
+
+std::string packet_id(uint16_t id)
+{
+    std::string body;
+    put_u16(body, id);
+    return body;
+}
+
+}  // namespace
+
+MqttClient::MqttClient(std::string host, uint16_t port, std::string client_id, uint16_t keepalive_s)
+    : host_(std::move(host)), port_(port), client_id_(std::move(client_id)), keepalive_s_(keepalive_s)
+{
+}
+
+MqttClient::~MqttClient()
+{
+    close_socket();
+}
+
+void MqttClient::close_socket()
+{
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    in_.clear();
+    // sin confirmar: el broker los vuelve a enviar en la siguiente conexión
+    unacked_.clear();
+}
+
+void MqttClient::connect(bool clean_session)
+{
+    close_socket();
+
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo *addresses = nullptr;
+    int err = getaddrinfo(host_.c_str(), std::to_string(port_).c_str(), &hints, &addresses);
+    if (err != 0) {
+        throw std::runtime_error("no se resuelve " + host_ + ": " + gai_strerror(err));
+    }
+
+    for (addrinfo *addr = addresses; addr && fd_ < 0; addr = addr->ai_next) {
+        fd_ = socket(addr->ai_family, addr->ai_socktype | SOCK_CLOEXEC, addr->ai_protocol);
+        if (fd_ >= 0 && ::connect(fd_, addr->ai_addr, addr->ai_addrlen) != 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+    freeaddrinfo(addresses);
+    if (fd_ < 0) {
+        throw std::runtime_error("no se puede conectar con " + host_ + ":" + std::to_string(port_));
+    }
+
+    int one = 1;
+    setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    std::string body;
+    put_string(body, "MQTT");
+    body += static_cast<char>(4);                        // MQTT 3.1.1
+    body += static_cast<char>(clean_session ? 0x02 : 0x00);
+    put_u16(body, keepalive_s_);
+    put_string(body, client_id_);
+    send_packet(CONNECT, body);
+
+    expect_packet(TYPE_CONNACK, body);
+    if (body.size() < 2 || body[1] != 0) {
+        throw std::runtime_error("conexión rechazada por el broker (código " +
+                                 std::to_string(body.size() < 2 ? -1 : static_cast<uint8_t>(body[1])) + ")");
+    }
+}
+
+void MqttClient::subscribe(const std::string &topic, uint8_t qos)
+{
+    // el SUBACK se comprueba en run(): con sesión persistente el broker puede
+    // enviar antes los mensajes que tenía pendientes
+    std::string body;
+    put_u16(body, next_id_);
+    next_id_ = next_id_ == 0xFFFF ? 1 : next_id_ + 1;
+    put_string(body, topic);
+    body += static_cast<char>(qos);
+    send_packet(SUBSCRIBE, body);
+}
+
+void MqttClient::disconnect()
+{
+    if (fd_ >= 0) {
+        try {
+            send_packet(DISCONNECT, {});
+        } catch (const std::exception &) {
+            // la conexión ya estaba perdida
+        }
+    }
+    close_socket();
+}
+
+void MqttClient::send_packet(uint8_t header, const std::string &body)
+{
+    std::string packet(1, static_cast<char>(header));
+    size_t length = body.size();
+    do {
+        uint8_t byte = length & 0x7F;
+        length >>= 7;
+        packet += static_cast<char>(length ? byte | 0x80 : byte);
+    } while (length);
+    packet += body;
+
+    size_t sent = 0;
+    while (sent < packet.size()) {
+        ssize_t n = ::send(fd_, packet.data() + sent, packet.size() - sent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error(std::string("error enviando al broker: ") + std::strerror(errno));
+        }
+        sent += static_cast<size_t>(n);
+    }
+    last_sent_ = std::chrono::steady_clock::now();
+}
+
+bool MqttClient::wait_readable(int timeout_ms)
+{
+    pollfd pfd{fd_, POLLIN, 0};
+    int n = poll(&pfd, 1, timeout_ms);
+    if (n < 0 && errno != EINTR) {
+        throw std::runtime_error(std::string("error esperando al broker: ") + std::strerror(errno));
+    }
+    return n > 0;
+}
+
+bool MqttClient::read_packet(uint8_t &header, std::string &body)
+{
+    for (;;) {
+        // cabecera fija: tipo y flags, y longitud restante en 1 a 4 bytes
+        if (in_.size() >= 2) {
+            size_t length = 0;
+            size_t pos = 1;
+            bool complete = false;
+            for (int shift = 0; pos < in_.size() && pos <= 4; shift += 7) {
+                uint8_t byte = static_cast<uint8_t>(in_[pos++]);
+                length |= static_cast<size_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    complete = true;
+                    break;
+                }
+            }
+            if (!complete && pos > 4) {
+                throw std::runtime_error("longitud de paquete MQTT no válida");
+            }
+            if (complete && in_.size() >= pos + length) {
+                header = static_cast<uint8_t>(in_[0]);
+                body.assign(in_, pos, length);
+                in_.erase(0, pos + length);
+                return true;
+            }
+        }
+
+        if (!wait_readable(POLL_MS)) {
+            return false;
+        }
+        char buffer[8192];
+        ssize_t n = recv(fd_, buffer, sizeof(buffer), 0);
+        if (n == 0) {
+            throw std::runtime_error("el broker ha cerrado la conexión");
+        }
+        if (n < 0) {
+            if (errno == EINTR || errno == EAGAIN) {
+                return false;
+            }
+            throw std::runtime_error(std::string("error leyendo del broker: ") + std::strerror(errno));
+        }
+        in_.append(buffer, static_cast<size_t>(n));
+        last_received_ = std::chrono::steady_clock::now();
+    }
+}
+
+void MqttClient::expect_packet(uint8_t type, std::string &body)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(CONNACK_TIMEOUT_MS);
+    uint8_t header = 0;
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (read_packet(header, body)) {
+            if (header >> 4 != type) {
+                throw std::runtime_error("respuesta inesperada del broker");
+            }
+            return;
+        }
+    }
+    throw std::runtime_error("el broker no responde");
+}
+
+void MqttClient::handle_publish(uint8_t header, const std::string &body, const Handler &handler)
+{
+    uint8_t qos = (header >> 1) & 0x03;
+    uint16_t topic_len = get_u16(body, 0);
+    size_t pos = 2 + topic_len;
+    if (pos > body.size()) {
+        throw std::runtime_error("paquete PUBLISH truncado");
+    }
+    std::string_view topic(body.data() + 2, topic_len);
+
+    uint16_t id = 0;
+    if (qos > 0) {
+        id = get_u16(body, pos);
+        pos += 2;
+    }
+
+    handler(topic, std::string_view(body.data() + pos, body.size() - pos));
+
+    if (qos > 0) {
+        if (unacked_.empty()) {
+            first_unacked_ = std::chrono::steady_clock::now();
+        }
+        unacked_.emplace_back(qos == 1 ? PUBACK : PUBREC, id);
+    }
+}
+
+void MqttClient::send_acks(const Flush &flush)
+{
+    if (unacked_.empty()) {
+        return;
+    }
+    if (flush) {
+        flush();
+    }
+    for (const auto &[type, id] : unacked_) {
+        send_packet(type, packet_id(id));
+    }
+    unacked_.clear();
+}
+
+void MqttClient::run(const std::atomic<bool> &stop, const Handler &handler, const Flush &flush)
+{
+    last_received_ = std::chrono::steady_clock::now();
+    const auto keepalive = std::chrono::seconds(keepalive_s_);
+
+    while (!stop) {
+        if (!unacked_.empty() &&
+            (unacked_.size() >= MAX_UNACKED ||
+             std::chrono::steady_clock::now() - first_unacked_ >= MAX_ACK_DELAY ||
+             (in_.empty() && !wait_readable(0)))) {
+            send_acks(flush);
+        }
+
+        uint8_t header = 0;
+        std::string body;
+        if (read_packet(header, body)) {
+            switch (header >> 4) {
+            case TYPE_PUBLISH:
+                handle_publish(header, body, handler);
+                break;
+            case TYPE_PUBREL:
+                send_packet(PUBCOMP, packet_id(get_u16(body, 0)));
+                break;
+            case TYPE_SUBACK:
+                if (body.size() < 3 || static_cast<uint8_t>(body[2]) == 0x80) {
+                    throw std::runtime_error("suscripción rechazada por el broker");
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (keepalive.count() > 0) {
+            if (now - last_sent_ >= keepalive / 2) {
+                send_packet(PINGREQ, {});
+            }
+            if (now - last_received_ > keepalive * 3 / 2) {
+                throw std::runtime_error("el broker no responde");
+            }
+        }
+    }
+    send_acks(flush);
+}
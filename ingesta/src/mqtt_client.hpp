@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// cliente MQTT 3.1.1 mínimo para suscribirse a un topic. Los PUBACK de los
+// PUBLISH con QoS 1 se agrupan: se envían después de llamar a flush, de modo
+// que el broker solo da los mensajes por entregados cuando la ingesta ya los
+// tiene guardados, con un fsync para todo el grupo.
+class MqttClient {
+public:
+    using Handler = std::function<void(std::string_view topic, std::string_view payload)>;
+    using Flush = std::function<void()>;
+
+    MqttClient(std::string host, uint16_t port, std::string client_id, uint16_t keepalive_s);
+    ~MqttClient();
+
+    MqttClient(const MqttClient &) = delete;
+    MqttClient &operator=(const MqttClient &) = delete;
+
+    // lanzan std::runtime_error si falla la conexión o el broker la rechaza
+    void connect(bool clean_session);
+    void subscribe(const std::string &topic, uint8_t qos);
+
+    // atiende la conexión hasta que stop sea true; lanza si se pierde. flush se
+    // llama antes de confirmar los mensajes recibidos: cuando no hay más
+    // esperando en el socket, o al acumular demasiados o demasiado tiempo
+    void run(const std::atomic<bool> &stop, const Handler &handler, const Flush &flush);
+
+    void disconnect();
+
+private:
+    void send_packet(uint8_t header, const std::string &body);
+    bool read_packet(uint8_t &header, std::string &body);
+    bool wait_readable(int timeout_ms);
+    void expect_packet(uint8_t type, std::string &body);
+    void handle_publish(uint8_t header, const std::string &body, const Handler &handler);
+    void send_acks(const Flush &flush);
+    void close_socket();
+
+    std::string host_;
+    uint16_t port_;
+    std::string client_id_;
+    uint16_t keepalive_s_;
+    int fd_ = -1;
+    uint16_t next_id_ = 1;
+    std::string in_;
+    std::chrono::steady_clock::time_point last_sent_;
+    std::chrono::steady_clock::time_point last_received_;
+    std::vector<std::pair<uint8_t, uint16_t>> unacked_;   // PUBACK o PUBREC pendiente e id del paquete
+    std::chrono::steady_clock::time_point first_unacked_;
+};
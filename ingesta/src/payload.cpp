@@ -0,0 +1,119 @@
+#include "payload.hpp"
+
+#include "ftm_mac.h"
+#include "json.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+const json::Value &require(const json::Value &object, std::string_view key)
+{
+    const json::Value *value = object.find(key);
+    if (!value) {
+        throw std::runtime_error("falta el campo " + std::string(key));
+    }
+    return *value;
+}
+
+MacKey require_mac(const json::Value &object, std::string_view key)
+{
+    const json::Value &value = require(object, key);
+    std::optional<MacKey> mac = value.is_string() ? parse_mac(value.string) : std::nullopt;
+    if (!mac) {
+        throw std::runtime_error("MAC no válida en " + std::string(key));
+    }
+    return *mac;
+}
+
+double require_number(const json::Value &object, std::string_view key)
+{
+    const json::Value &value = require(object, key);
+    if (!value.is_number() || !std::isfinite(value.number)) {
+        throw std::runtime_error("número no válido en " + std::string(key));
+    }
+    return value.number;
+}
+
+std::optional<double> optional_number(const json::Value &object, std::string_view key)
+{
+    const json::Value *value = object.find(key);
+    if (!value || !value->is_number() || !std::isfinite(value->number)) {
+        return std::nullopt;
+    }
+    return value->number;
+}
+
+std::optional<int16_t> optional_smallint(const json::Value &object, std::string_view key)
+{
+    std::optional<double> number = optional_number(object, key);
+    if (!number || *number < std::numeric_limits<int16_t>::min() || *number > std::numeric_limits<int16_t>::max()) {
+        return std::nullopt;
+    }
+    return static_cast<int16_t>(std::lround(*number));
+}
+
+}  // namespace
+
+std::optional<MacKey> parse_mac(std::string_view text)
+{
+    uint8_t mac[6];
+    if (ftm_mac_parse(text.data(), text.size(), mac) != 0) {
+        return std::nullopt;
+    }
+    return ftm_mac_to_u64(mac);
+}
+
+std::string format_mac(MacKey key)
+{
+    uint8_t mac[6];
+    char text[FTM_MAC_STR_LEN];
+    ftm_mac_from_u64(key, mac);
+    ftm_mac_format(mac, text);
+    return text;
+}
+
+Message parse_message(std::string_view payload)
+{
+    json::Value root = json::parse(payload);
+    if (!root.is_array() || root.items.empty() || !root.items[0].is_object()) {
+        throw std::runtime_error("Formato de JSON no reconocido");
+    }
+
+    Message message;
+    const json::Value &first = root.items[0];
+
+    if (first.find("mac_anchor")) {
+        for (const json::Value &item : root.items) {
+            AnchorRow row;
+            row.mac = require_mac(item, "mac_anchor");
+            row.positionx = optional_number(item, "positionx");
+            row.positiony = optional_number(item, "positiony");
+            row.positionz = optional_number(item, "positionz");
+            row.ftm_offset_cm = optional_smallint(item, "ftm_offset_cm");
+            row.channel = optional_smallint(item, "channel");
+            message.anchors.push_back(std::move(row));
+        }
+    } else if (first.find("mac_src") && first.find("mac_dst")) {
+        for (const json::Value &item : root.items) {
+            MeasurementRow row;
+            row.mac_src = require_mac(item, "mac_src");
+            row.mac_dst = require_mac(item, "mac_dst");
+            row.distance_cm = require_number(item, "distance_cm");
+            row.rtt_ns = require_number(item, "rtt_ns");
+            if (std::optional<double> ts = optional_number(item, "ts_ms"); ts && *ts >= MIN_EPOCH_MS && *ts < MAX_EPOCH_MS) {
+                row.ts_ms = static_cast<int64_t>(*ts);
+            }
+            if (std::optional<double> seq = optional_number(item, "seq"); seq && *seq >= 0 && *seq <= 0xFFFF) {
+                row.seq = static_cast<int32_t>(*seq);
+            }
+            message.measurements.push_back(std::move(row));
+        }
+    } else {
+        throw std::runtime_error("Formato de JSON no reconocido");
+    }
+
+    return message;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+// MAC como entero de 48 bits (ftm_mac_to_u64), clave de la caché y del COPY a macaddr
+using MacKey = uint64_t;
+
+// un ts_ms anterior a 2001 no es hora real: el tag no estaba sincronizado
+constexpr int64_t MIN_EPOCH_MS = 1000000000000;
+// ni uno de 2100 en adelante: viene de una trama corrupta y desbordaría los µs del COPY
+constexpr int64_t MAX_EPOCH_MS = 4102444800000;
+
+// anuncio de un anchor (mac_anchor, posición, offset y canal)
+struct AnchorRow {
+    MacKey mac = 0;
+    std::optional<double> positionx;
+    std::optional<double> positiony;
+    std::optional<double> positionz;
+    std::optional<int16_t> ftm_offset_cm;
+    std::optional<int16_t> channel;
+};
+
+// medida de un tag contra un anchor
+struct MeasurementRow {
+    MacKey mac_src = 0;
+    MacKey mac_dst = 0;
+    double distance_cm = 0.0;
+    double rtt_ns = 0.0;
+    std::optional<int64_t> ts_ms;   // hora del tag en ms desde epoch, solo si está sincronizado
+    std::optional<int32_t> seq;     // número de ronda del tag (uint16), si lo envía
+};
+
+// contenido de un mensaje del topic de datos: o anchors o medidas, como en el flujo de Node-RED
+struct Message {
+    std::vector<AnchorRow> anchors;
+    std::vector<MeasurementRow> measurements;
+    Clock::time_point received;
+    uint64_t seq = 0;   // número de secuencia en el spool
+
+    size_t rows() const { return anchors.size() + measurements.size(); }
+};
+
+// MAC en formato AA:BB:CC:DD:EE:FF (también la salida de macaddr de PostgreSQL)
+std::optional<MacKey> parse_mac(std::string_view text);
+std::string format_mac(MacKey mac);
+
+// lanza std::runtime_error si el JSON no sigue ninguna de las dos estructuras
+Message parse_message(std::string_view payload);
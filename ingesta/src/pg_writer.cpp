@@ -0,0 +1,590 @@
+#include "pg_writer.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+namespace {
+
+// 2000-01-01 en ms desde el epoch Unix, origen de los timestamp de PostgreSQL
+constexpr int64_t POSTGRES_EPOCH_MS = 946684800000;
+
+// tabla temporal de cada conexión para hacer upsert de los anchors tras el COPY
+const char *CREATE_DEVICES_STAGE = R"(
+    CREATE TEMP TABLE devices_stage (
+        mac macaddr,
+        positionx double precision,
+        positiony double precision,
+        positionz double precision,
+        ftm_offset_cm smallint,
+        channel smallint
+    ) ON COMMIT DELETE ROWS
+)";
+
+const char *UPSERT_ANCHORS = R"(
+    INSERT INTO devices (mac, id_type, positionx, positiony, positionz, ftm_offset_cm, channel)
+    SELECT mac, 1, positionx, positiony, positionz, COALESCE(ftm_offset_cm, 0), channel -- id_type = 1 para los nodos anchors
+    FROM devices_stage
+    ORDER BY mac
+    ON CONFLICT (mac) DO UPDATE
+    SET positionx = EXCLUDED.positionx,
+        positiony = EXCLUDED.positiony,
+        positionz = EXCLUDED.positionz,
+        ftm_offset_cm = EXCLUDED.ftm_offset_cm,
+        channel = EXCLUDED.channel
+    RETURNING id, mac
+)";
+
+// da de alta las MAC que no existan y devuelve el id de todas. Con DO NOTHING
+// una MAC dada de alta por otro escritor tras la instantánea de la sentencia no
+// se devolvía; DO UPDATE bloquea la fila existente y la devuelve. Se actualiza
+// id_type, que no es de las columnas del trigger devices_changed, para no
+// notificar un cambio que no hay
+const char *RESOLVE_DEVICES = R"(
+    INSERT INTO devices (mac, id_type)
+    SELECT * FROM unnest($1::macaddr[], $2::integer[]) AS m(mac, id_type)
+    ORDER BY mac
+    ON CONFLICT (mac) DO UPDATE SET id_type = devices.id_type
+    RETURNING id, mac
+)";
+
+// rondas (tag, número de ronda) del lote que no se habían recibido ya: una ronda
+// repetida por el tag (reintento por ESP-NOW y luego por MQTT) o por el broker
+// no devuelve fila. Pasada una hora el número se puede reutilizar (es un
+// uint16, o el tag se ha reiniciado) y cuenta como ronda nueva; el mismo plazo
+// que en el flujo de Node-RED
+const char *REGISTER_ROUNDS = R"(
+    INSERT INTO tag_rounds AS r (id_src, seq)
+    SELECT * FROM unnest($1::integer[], $2::integer[]) AS n(id_src, seq)
+    ORDER BY id_src, seq
+    ON CONFLICT (id_src, seq) DO UPDATE SET ts = EXCLUDED.ts
+    WHERE r.ts < EXCLUDED.ts - interval '1 hour'
+    RETURNING id_src, seq
+)";
+
+// suma el acumulado del lote de cada par (tag, anchor) a pair_stats: una fila por
+// par y lote, en orden de par para que los escritores concurrentes no se
+// interbloqueen. La última medida es la de hora más reciente, la del tag si está
+// sincronizado y si no la de ingesta
+const char *UPDATE_PAIR_STATS = R"(
+    INSERT INTO pair_stats AS p (id_src, id_dst, n, sum_cm, sumsq_cm, last_cm, last_ts)
+    SELECT id_src, id_dst, n, sum_cm, sumsq_cm, last_cm, COALESCE(to_timestamp(last_ms / 1000.0), now())
+    FROM unnest($1::integer[], $2::integer[], $3::bigint[], $4::float8[], $5::float8[], $6::float8[], $7::bigint[])
+        AS s(id_src, id_dst, n, sum_cm, sumsq_cm, last_cm, last_ms)
+    ORDER BY id_src, id_dst
+    ON CONFLICT (id_src, id_dst) DO UPDATE
+    SET n = p.n + EXCLUDED.n,
+        sum_cm = p.sum_cm + EXCLUDED.sum_cm,
+        sumsq_cm = p.sumsq_cm + EXCLUDED.sumsq_cm,
+        last_cm = CASE WHEN EXCLUDED.last_ts >= p.last_ts THEN EXCLUDED.last_cm ELSE p.last_cm END,
+        last_ts = GREATEST(p.last_ts, EXCLUDED.last_ts)
+)";
+
+// secuencias del spool escritas en el lote, como rangos [first_seq, last_seq]
+const char *RECORD_SPOOLED = R"(
+    INSERT INTO ingest_spool (spool, first_seq, last_seq)
+    SELECT $1, * FROM unnest($2::bigint[], $3::bigint[])
+    ON CONFLICT (spool, first_seq) DO UPDATE
+    SET last_seq = GREATEST(ingest_spool.last_seq, EXCLUDED.last_seq)
+)";
+
+// todo hasta la marca de agua queda en la fila con first_seq = 0
+const char *COMPACT_SPOOLED = R"(
+    WITH borrados AS (
+        DELETE FROM ingest_spool WHERE spool = $1 AND first_seq > 0 AND last_seq <= $2
+    )
+    INSERT INTO ingest_spool (spool, first_seq, last_seq) VALUES ($1, 0, $2)
+    ON CONFLICT (spool, first_seq) DO UPDATE
+    SET last_seq = GREATEST(ingest_spool.last_seq, EXCLUDED.last_seq)
+)";
+
+// errores que no dependen de los datos del lote
+bool is_retryable(PGconn *conn, PGresult *result)
+{
+    const char *sqlstate = result ? PQresultErrorField(result, PG_DIAG_SQLSTATE) : nullptr;
+    return PQstatus(conn) != CONNECTION_OK ||
+           !sqlstate ||                             // error del cliente o de la conexión
+           std::strncmp(sqlstate, "40", 2) == 0 ||  // serialización, interbloqueo
+           std::strncmp(sqlstate, "08", 2) == 0 ||  // conexión
+           std::strncmp(sqlstate, "53", 2) == 0 ||  // recursos insuficientes
+           std::strncmp(sqlstate, "57P", 3) == 0;   // servidor deteniéndose
+}
+
+// formato binario de COPY: cabecera, tuplas con campos precedidos de su
+// longitud (-1 para NULL), todo en orden de red, y marca final
+class CopyBuffer {
+public:
+    CopyBuffer()
+    {
+        data_.append("PGCOPY\n\377\r\n\0", 11);
+        put32(0);   // flags
+        put32(0);   // longitud de la extensión de cabecera
+    }
+
+    void begin_row(int16_t fields) { put16(fields); }
+
+    void add_int2(int16_t value)
+    {
+        put32(2);
+        put16(value);
+    }
+
+    void add_int4(int32_t value)
+    {
+        put32(4);
+        put32(static_cast<uint32_t>(value));
+    }
+
+    void add_float8(double value)
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        put32(8);
+        put32(static_cast<uint32_t>(bits >> 32));
+        put32(static_cast<uint32_t>(bits));
+    }
+
+    // macaddr: los 6 bytes de la dirección
+    void add_macaddr(MacKey mac)
+    {
+        put32(6);
+        for (int shift = 40; shift >= 0; shift -= 8) {
+            data_ += static_cast<char>((mac >> shift) & 0xFF);
+        }
+    }
+
+    // timestamptz: microsegundos desde 2000-01-01 UTC
+    void add_timestamptz_ms(int64_t epoch_ms)
+    {
+        uint64_t usec = static_cast<uint64_t>((epoch_ms - POSTGRES_EPOCH_MS) * 1000);
+        put32(8);
+        put32(static_cast<uint32_t>(usec >> 32));
+        put32(static_cast<uint32_t>(usec));
+    }
+
+    void add_null() { put32(0xFFFFFFFF); }
+
+    template <typename T>
+    void add_optional(const std::optional<T> &value)
+    {
+        if (!value) {
+            add_null();
+        } else if constexpr (std::is_same_v<T, int16_t>) {
+            add_int2(*value);
+        } else {
+            add_float8(*value);
+        }
+    }
+
+    const std::string &finish()
+    {
+        put16(-1);
+        return data_;
+    }
+
+private:
+    void put16(int16_t value)
+    {
+        data_ += static_cast<char>(static_cast<uint16_t>(value) >> 8);
+        data_ += static_cast<char>(value & 0xFF);
+    }
+
+    void put32(uint32_t value)
+    {
+        data_ += static_cast<char>(value >> 24);
+        data_ += static_cast<char>((value >> 16) & 0xFF);
+        data_ += static_cast<char>((value >> 8) & 0xFF);
+        data_ += static_cast<char>(value & 0xFF);
+    }
+
+    std::string data_;
+};
+
+// literal de array de PostgreSQL; los elementos (MAC con format_mac, enteros) no necesitan comillas
+template <typename It, typename F>
+std::string array_literal(It first, It last, F element)
+{
+    std::string out = "{";
+    for (It it = first; it != last; ++it) {
+        if (it != first) {
+            out += ',';
+        }
+        out += element(*it);
+    }
+    out += '}';
+    return out;
+}
+
+// float8 en texto sin perder precisión
+std::string format_float8(double value)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.17g", value);
+    return buf;
+}
+
+// columna macaddr de un resultado en formato texto
+MacKey result_mac(PGresult *result, int row, int column)
+{
+    std::optional<MacKey> mac = parse_mac(PQgetvalue(result, row, column));
+    if (!mac) {
+        throw PgError(std::string("MAC no válida devuelta por PostgreSQL: ") + PQgetvalue(result, row, column), false);
+    }
+    return *mac;
+}
+
+}  // namespace
+
+PgWriter::PgWriter(std::string conninfo, DeviceCache &cache, std::string spool_id)
+    : conninfo_(std::move(conninfo)), cache_(cache), spool_id_(std::move(spool_id))
+{
+}
+
+PgWriter::~PgWriter()
+{
+    disconnect();
+}
+
+void PgWriter::disconnect()
+{
+    if (conn_) {
+        PQfinish(conn_);
+        conn_ = nullptr;
+    }
+}
+
+[[noreturn]] void PgWriter::fail(const std::string &what, PGresult *result)
+{
+    std::string message = what + ": " + PQerrorMessage(conn_);
+    bool retryable = is_retryable(conn_, result);
+    const char *sqlstate = result ? PQresultErrorField(result, PG_DIAG_SQLSTATE) : nullptr;
+    if (sqlstate && std::strcmp(sqlstate, "23503") == 0) {
+        // id de la caché borrado de devices antes de que llegara la notificación:
+        // se vacía y el lote se repite resolviendo las MAC de nuevo
+        cache_.clear();
+        retryable = true;
+    }
+    PQclear(result);
+    if (PQstatus(conn_) != CONNECTION_OK) {
+        disconnect();
+    }
+    throw PgError(message, retryable);
+}
+
+void PgWriter::ensure_connected()
+{
+    if (conn_ && PQstatus(conn_) == CONNECTION_OK) {
+        return;
+    }
+    disconnect();
+
+    conn_ = PQconnectdb(conninfo_.c_str());
+    if (PQstatus(conn_) != CONNECTION_OK) {
+        std::string message = std::string("no se puede conectar con PostgreSQL: ") + PQerrorMessage(conn_);
+        disconnect();
+        throw PgError(message, true);
+    }
+    exec(CREATE_DEVICES_STAGE);
+}
+
+void PgWriter::exec(const char *sql)
+{
+    PGresult *result = PQexec(conn_, sql);
+    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+        fail("error en la consulta", result);
+    }
+    PQclear(result);
+}
+
+void PgWriter::copy_in(const char *sql, const std::string &data)
+{
+    PGresult *result = PQexec(conn_, sql);
+    if (PQresultStatus(result) != PGRES_COPY_IN) {
+        fail("error iniciando COPY", result);
+    }
+    PQclear(result);
+
+    if (PQputCopyData(conn_, data.data(), static_cast<int>(data.size())) != 1 ||
+        PQputCopyEnd(conn_, nullptr) != 1) {
+        fail("error enviando COPY", nullptr);
+    }
+
+    // se leen todos los resultados para dejar libre la conexión
+    PGresult *error = nullptr;
+    while ((result = PQgetResult(conn_)) != nullptr) {
+        if (PQresultStatus(result) != PGRES_COMMAND_OK && !error) {
+            error = result;
+        } else {
+            PQclear(result);
+        }
+    }
+    if (error) {
+        fail("error en COPY", error);
+    }
+}
+
+void PgWriter::write(const Batch &batch)
+{
+    ensure_connected();
+    uint64_t generation = cache_.generation();
+    new_ids_.clear();
+    exec("BEGIN");
+    try {
+        if (!batch.anchors.empty()) {
+            write_anchors(batch.anchors);
+        }
+        if (!batch.measurements.empty()) {
+            write_measurements(batch.measurements);
+        }
+        if (!batch.seqs.empty()) {
+            record_spooled(batch.seqs);
+        }
+        exec("COMMIT");
+        cache_.put(new_ids_, generation);
+    } catch (...) {
+        if (conn_ && PQstatus(conn_) == CONNECTION_OK) {
+            PQclear(PQexec(conn_, "ROLLBACK"));
+        }
+        throw;
+    }
+}
+
+void PgWriter::write_anchors(const std::vector<AnchorRow> &anchors)
+{
+    // el último anuncio de cada anchor en el lote es el que vale
+    std::map<MacKey, const AnchorRow *> latest;
+    for (const AnchorRow &row : anchors) {
+        latest[row.mac] = &row;
+    }
+
+    CopyBuffer copy;
+    for (const auto &[mac, row] : latest) {
+        copy.begin_row(6);
+        copy.add_macaddr(mac);
+        copy.add_optional(row->positionx);
+        copy.add_optional(row->positiony);
+        copy.add_optional(row->positionz);
+        copy.add_optional(row->ftm_offset_cm);
+        copy.add_optional(row->channel);
+    }
+    copy_in("COPY devices_stage (mac, positionx, positiony, positionz, ftm_offset_cm, channel) FROM STDIN (FORMAT binary)",
+            copy.finish());
+
+    PGresult *result = PQexec(conn_, UPSERT_ANCHORS);
+    if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+        fail("error actualizando anchors", result);
+    }
+    for (int i = 0; i < PQntuples(result); ++i) {
+        new_ids_[result_mac(result, i, 1)] = static_cast<int32_t>(std::stol(PQgetvalue(result, i, 0)));
+    }
+    PQclear(result);
+}
+
+std::map<MacKey, int32_t> PgWriter::resolve_devices(const std::vector<MeasurementRow> &measurements)
+{
+    std::map<MacKey, int32_t> ids;
+
+    // id_type = 2 para los tags y 1 para los anchors; si una MAC aparece como
+    // ambos se queda como tag, igual que en el flujo de Node-RED
+    std::map<MacKey, int> pending;
+    auto add = [&](MacKey mac, int id_type) {
+        if (auto it = pending.find(mac); it != pending.end()) {
+            it->second = std::max(it->second, id_type);
+        } else if (ids.count(mac)) {
+            return;
+        } else if (auto it = new_ids_.find(mac); it != new_ids_.end()) {
+            ids[mac] = it->second;
+        } else if (std::optional<int32_t> id = cache_.find(mac)) {
+            ids[mac] = *id;
+        } else {
+            pending[mac] = id_type;
+        }
+    };
+    for (const MeasurementRow &row : measurements) {
+        add(row.mac_dst, 1);
+        add(row.mac_src, 2);
+    }
+    if (pending.empty()) {
+        return ids;
+    }
+
+    std::string macs = array_literal(pending.begin(), pending.end(), [](const auto &p) { return format_mac(p.first); });
+    std::string types = array_literal(pending.begin(), pending.end(),
+                                      [](const auto &p) { return std::to_string(p.second); });
+    const char *params[] = {macs.c_str(), types.c_str()};
+
+    PGresult *result = PQexecParams(conn_, RESOLVE_DEVICES, 2, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+        fail("error dando de alta dispositivos", result);
+    }
+    for (int i = 0; i < PQntuples(result); ++i) {
+        MacKey mac = result_mac(result, i, 1);
+        ids[mac] = new_ids_[mac] = static_cast<int32_t>(std::stol(PQgetvalue(result, i, 0)));
+        pending.erase(mac);
+    }
+    PQclear(result);
+
+    if (!pending.empty()) {
+        throw PgError("no se han podido resolver " + std::to_string(pending.size()) + " MAC", true);
+    }
+    return ids;
+}
+
+std::set<std::pair<int32_t, int32_t>> PgWriter::register_rounds(const std::vector<MeasurementRow> &measurements,
+                                                                const std::map<MacKey, int32_t> &ids)
+{
+    // una ronda llega en varias filas y puede repetirse en el lote
+    std::set<std::pair<int32_t, int32_t>> rounds;
+    for (const MeasurementRow &row : measurements) {
+        if (row.seq) {
+            rounds.emplace(ids.at(row.mac_src), *row.seq);
+        }
+    }
+    if (rounds.empty()) {
+        return rounds;
+    }
+
+    std::string id_src = array_literal(rounds.begin(), rounds.end(), [](const auto &r) { return std::to_string(r.first); });
+    std::string seq = array_literal(rounds.begin(), rounds.end(), [](const auto &r) { return std::to_string(r.second); });
+    const char *params[] = {id_src.c_str(), seq.c_str()};
+
+    PGresult *result = PQexecParams(conn_, REGISTER_ROUNDS, 2, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+        fail("error registrando las rondas", result);
+    }
+    std::set<std::pair<int32_t, int32_t>> fresh;
+    for (int i = 0; i < PQntuples(result); ++i) {
+        fresh.emplace(static_cast<int32_t>(std::stol(PQgetvalue(result, i, 0))),
+                      static_cast<int32_t>(std::stol(PQgetvalue(result, i, 1))));
+    }
+    PQclear(result);
+    return fresh;
+}
+
+void PgWriter::write_measurements(const std::vector<MeasurementRow> &measurements)
+{
+    std::map<MacKey, int32_t> ids = resolve_devices(measurements);
+    std::set<std::pair<int32_t, int32_t>> rounds = register_rounds(measurements, ids);
+
+    // una ronda nueva puede venir repetida en el mismo lote: de cada una se
+    // escribe una sola vez la medida de cada anchor
+    std::set<std::tuple<int32_t, int32_t, MacKey>> written;
+
+    CopyBuffer copy;
+    std::map<std::pair<int32_t, int32_t>, PairStats> stats;
+    size_t rows = 0;
+    for (const MeasurementRow &row : measurements) {
+        if (row.seq && (!rounds.count({ids.at(row.mac_src), *row.seq}) ||
+                        !written.emplace(ids.at(row.mac_src), *row.seq, row.mac_dst).second)) {
+            continue;
+        }
+        ++rows;
+
+        // sin hora del tag la medida es de la hora de ingesta, posterior a todas
+        PairStats &pair = stats[{ids.at(row.mac_src), ids.at(row.mac_dst)}];
+        if (pair.n == 0 || !row.ts_ms || (pair.last_ms && *row.ts_ms >= *pair.last_ms)) {
+            pair.last_cm = row.distance_cm;
+            pair.last_ms = row.ts_ms;
+        }
+        ++pair.n;
+        pair.sum_cm += row.distance_cm;
+        pair.sumsq_cm += row.distance_cm * row.distance_cm;
+
+        copy.begin_row(5);
+        copy.add_int4(ids.at(row.mac_src));
+        copy.add_int4(ids.at(row.mac_dst));
+        copy.add_float8(row.distance_cm);
+        copy.add_float8(row.rtt_ns);
+        if (row.ts_ms) {
+            copy.add_timestamptz_ms(*row.ts_ms);
+        } else {
+            copy.add_null();
+        }
+    }
+    if (rows == 0) {
+        return;
+    }
+    // ts, la hora de ingesta, es el now() por defecto de la transacción
+    copy_in("COPY data_tag (id_src, id_dst, distance_cm, rtt_ns, ts_device) FROM STDIN (FORMAT binary)",
+            copy.finish());
+    update_pair_stats(stats);
+}
+
+void PgWriter::update_pair_stats(const std::map<std::pair<int32_t, int32_t>, PairStats> &stats)
+{
+    auto column = [&](auto element) { return array_literal(stats.begin(), stats.end(), element); };
+    std::string id_src = column([](const auto &s) { return std::to_string(s.first.first); });
+    std::string id_dst = column([](const auto &s) { return std::to_string(s.first.second); });
+    std::string n = column([](const auto &s) { return std::to_string(s.second.n); });
+    std::string sum_cm = column([](const auto &s) { return format_float8(s.second.sum_cm); });
+    std::string sumsq_cm = column([](const auto &s) { return format_float8(s.second.sumsq_cm); });
+    std::string last_cm = column([](const auto &s) { return format_float8(s.second.last_cm); });
+    std::string last_ms = column([](const auto &s) {
+        return s.second.last_ms ? std::to_string(*s.second.last_ms) : std::string("NULL");
+    });
+    const char *params[] = {id_src.c_str(), id_dst.c_str(), n.c_str(), sum_cm.c_str(),
+                            sumsq_cm.c_str(), last_cm.c_str(), last_ms.c_str()};
+
+    PGresult *result = PQexecParams(conn_, UPDATE_PAIR_STATS, 7, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+        fail("error actualizando pair_stats", result);
+    }
+    PQclear(result);
+}
+
+void PgWriter::record_spooled(const std::vector<uint64_t> &seqs)
+{
+    // normalmente un solo rango: los mensajes de un lote son consecutivos salvo
+    // los descartados y, al arrancar, los ya escritos antes de una caída
+    std::vector<uint64_t> sorted = seqs;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    for (uint64_t seq : sorted) {
+        if (!ranges.empty() && seq <= ranges.back().second + 1) {
+            ranges.back().second = std::max(ranges.back().second, seq);
+        } else {
+            ranges.emplace_back(seq, seq);
+        }
+    }
+
+    std::string firsts = array_literal(ranges.begin(), ranges.end(), [](const auto &r) { return std::to_string(r.first); });
+    std::string lasts = array_literal(ranges.begin(), ranges.end(), [](const auto &r) { return std::to_string(r.second); });
+    const char *params[] = {spool_id_.c_str(), firsts.c_str(), lasts.c_str()};
+    PGresult *result = PQexecParams(conn_, RECORD_SPOOLED, 3, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+        fail("error anotando las secuencias del spool", result);
+    }
+    PQclear(result);
+}
+
+std::vector<std::pair<uint64_t, uint64_t>> PgWriter::spooled_ranges()
+{
+    ensure_connected();
+    const char *params[] = {spool_id_.c_str()};
+    PGresult *result = PQexecParams(conn_, "SELECT first_seq, last_seq FROM ingest_spool WHERE spool = $1",
+                                    1, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_TUPLES_OK) {
+        fail("error leyendo ingest_spool", result);
+    }
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    for (int i = 0; i < PQntuples(result); ++i) {
+        ranges.emplace_back(std::stoull(PQgetvalue(result, i, 0)), std::stoull(PQgetvalue(result, i, 1)));
+    }
+    PQclear(result);
+    return ranges;
+}
+
+void PgWriter::compact_spooled(uint64_t watermark)
+{
+    ensure_connected();
+    std::string upto = std::to_string(watermark);
+    const char *params[] = {spool_id_.c_str(), upto.c_str()};
+    PGresult *result = PQexecParams(conn_, COMPACT_SPOOLED, 2, nullptr, params, nullptr, nullptr, 0);
+    if (PQresultStatus(result) != PGRES_COMMAND_OK) {
+        fail("error compactando ingest_spool", result);
+    }
+    PQclear(result);
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "batcher.hpp"
+#include "device_cache.hpp"
+
+#include <libpq-fe.h>
+
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// error de PostgreSQL; retryable indica que el lote puede volver a intentarse
+// (conexión perdida, interbloqueo...) y no es un problema de los datos
+class PgError : public std::runtime_error {
+public:
+    PgError(const std::string &what, bool retryable) : std::runtime_error(what), retryable(retryable) {}
+
+    const bool retryable;
+};
+
+// acumulado de las medidas de un par (tag, anchor) escritas en un lote
+struct PairStats {
+    int64_t n = 0;
+    double sum_cm = 0.0;
+    double sumsq_cm = 0.0;
+    double last_cm = 0.0;
+    std::optional<int64_t> last_ms;   // hora del tag de la última medida; sin ella, la de ingesta
+};
+
+// escritor de lotes sobre una conexión propia; cada hilo del pool tiene uno.
+// Las filas de data_tag se escriben con los id de la caché; solo las MAC que
+// no están en ella pasan por devices. Con cada lote se actualiza pair_stats y se
+// anotan en ingest_spool las secuencias del spool que contiene, en la misma
+// transacción.
+class PgWriter {
+public:
+    PgWriter(std::string conninfo, DeviceCache &cache, std::string spool_id);
+    ~PgWriter();
+
+    PgWriter(const PgWriter &) = delete;
+    PgWriter &operator=(const PgWriter &) = delete;
+
+    // escribe el lote en una transacción; lanza PgError
+    void write(const Batch &batch);
+
+    // rangos de secuencias del spool ya escritos, y compactación de los
+    // anteriores a la marca de agua en una sola fila; lanzan PgError
+    std::vector<std::pair<uint64_t, uint64_t>> spooled_ranges();
+    void compact_spooled(uint64_t watermark);
+
+private:
+    void ensure_connected();
+    void disconnect();
+    void exec(const char *sql);
+    void copy_in(const char *sql, const std::string &data);
+    void write_anchors(const std::vector<AnchorRow> &anchors);
+    std::map<MacKey, int32_t> resolve_devices(const std::vector<MeasurementRow> &measurements);
+    std::set<std::pair<int32_t, int32_t>> register_rounds(const std::vector<MeasurementRow> &measurements,
+                                                          const std::map<MacKey, int32_t> &ids);
+    void write_measurements(const std::vector<MeasurementRow> &measurements);
+    void update_pair_stats(const std::map<std::pair<int32_t, int32_t>, PairStats> &stats);
+    void record_spooled(const std::vector<uint64_t> &seqs);
+    [[noreturn]] void fail(const std::string &what, PGresult *result);
+
+    std::string conninfo_;
+    DeviceCache &cache_;
+    std::string spool_id_;
+    PGconn *conn_ = nullptr;
+    std::map<MacKey, int32_t> new_ids_;   // ids leídos en la transacción, a la caché tras el COMMIT
+};
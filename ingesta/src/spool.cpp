@@ -0,0 +1,522 @@
+#include "spool.hpp"
+
+#include "log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// cabecera de registro: longitud del mensaje, CRC-32 de secuencia y mensaje,
+// y número de secuencia, en little endian
+constexpr size_t HEADER_BYTES = 16;
+
+// lectura del drenador por bloques
+constexpr size_t READ_CHUNK = 4 << 20;
+
+// mensajes hechos entre compactaciones de ingest_spool
+constexpr uint64_t COMPACT_EVERY = 10000;
+
+constexpr std::array<uint32_t, 256> make_crc_table()
+{
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+constexpr std::array<uint32_t, 256> CRC_TABLE = make_crc_table();
+
+uint32_t crc32(uint32_t crc, const char *data, size_t size)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < size; ++i) {
+        crc = CRC_TABLE[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+void put_le(std::string &out, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i) {
+        out += static_cast<char>((value >> (8 * i)) & 0xFF);
+    }
+}
+
+uint64_t get_le(const char *p, int bytes)
+{
+    uint64_t value = 0;
+    for (int i = bytes - 1; i >= 0; --i) {
+        value = (value << 8) | static_cast<uint8_t>(p[i]);
+    }
+    return value;
+}
+
+[[noreturn]] void throw_errno(const std::string &what)
+{
+    throw std::runtime_error(what + ": " + std::strerror(errno));
+}
+
+// registro completo y válido en data[pos..]; devuelve su tamaño o 0
+size_t check_record(const std::string &data, size_t pos, uint64_t &seq)
+{
+    if (data.size() - pos < HEADER_BYTES) {
+        return 0;
+    }
+    const char *p = data.data() + pos;
+    uint64_t length = get_le(p, 4);
+    if (data.size() - pos - HEADER_BYTES < length) {
+        return 0;
+    }
+    uint32_t crc = crc32(0, p + 8, 8 + length);
+    if (crc != get_le(p + 4, 4)) {
+        return 0;
+    }
+    seq = get_le(p + 8, 8);
+    return HEADER_BYTES + length;
+}
+
+std::string read_file(const std::string &path, uint64_t offset, uint64_t size)
+{
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw_errno("no se puede abrir " + path);
+    }
+    std::string data(size, '\0');
+    size_t done = 0;
+    while (done < size) {
+        ssize_t n = pread(fd, &data[done], size - done, static_cast<off_t>(offset + done));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            int err = errno;
+            ::close(fd);
+            errno = n == 0 ? EIO : err;
+            throw_errno("error leyendo " + path);
+        }
+        done += static_cast<size_t>(n);
+    }
+    ::close(fd);
+    return data;
+}
+
+void fsync_dir(const std::string &dir)
+{
+    int fd = ::open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+}
+
+}  // namespace
+
+Spool::Spool(std::string dir, size_t segment_bytes) : dir_(std::move(dir)), segment_bytes_(segment_bytes)
+{
+    if (mkdir(dir_.c_str(), 0755) != 0 && errno != EEXIST) {
+        throw_errno("no se puede crear el spool " + dir_);
+    }
+    load_id();
+
+    // segmentos NNNNNNNNNNNNNNNNNNNN.seg, con la secuencia de su primer mensaje
+    DIR *d = opendir(dir_.c_str());
+    if (!d) {
+        throw_errno("no se puede leer el spool " + dir_);
+    }
+    while (dirent *entry = readdir(d)) {
+        std::string name = entry->d_name;
+        if (name.size() != 24 || name.compare(20, 4, ".seg") != 0 ||
+            !std::all_of(name.begin(), name.begin() + 20, [](char c) { return c >= '0' && c <= '9'; })) {
+            continue;
+        }
+        std::string path = dir_ + "/" + name;
+        struct stat st {};
+        if (stat(path.c_str(), &st) == 0) {
+            segments_.push_back({std::stoull(name.substr(0, 20)), path, static_cast<uint64_t>(st.st_size)});
+        }
+    }
+    closedir(d);
+    std::sort(segments_.begin(), segments_.end(),
+              [](const Segment &a, const Segment &b) { return a.first_seq < b.first_seq; });
+
+    if (!segments_.empty()) {
+        recover_tail();
+        // lo anterior al primer segmento ya se borró por estar hecho
+        watermark_ = segments_.front().first_seq - 1;
+        read_first_ = segments_.front().first_seq;
+    }
+    last_seq_ = next_seq_ - 1;
+    read_seq_ = watermark_;
+    compacted_ = stats_watermark_ = watermark_;
+    stats_seq_ = last_seq_;
+}
+
+Spool::~Spool()
+{
+    if (active_fd_ >= 0) {
+        ::close(active_fd_);
+    }
+}
+
+void Spool::load_id()
+{
+    std::string path = dir_ + "/id";
+    if (FILE *f = std::fopen(path.c_str(), "r")) {
+        char line[128] = {};
+        if (std::fgets(line, sizeof(line), f)) {
+            id_ = line;
+            id_.erase(id_.find_last_not_of(" \r\n") + 1);
+        }
+        std::fclose(f);
+    }
+    if (!id_.empty()) {
+        return;
+    }
+
+    // un spool nuevo no debe heredar los rangos de otro en ingest_spool
+    char host[64] = {};
+    gethostname(host, sizeof(host) - 1);
+    char text[128];
+    std::snprintf(text, sizeof(text), "%s-%llx", host,
+                  static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::microseconds>(
+                      std::chrono::system_clock::now().time_since_epoch()).count()));
+    id_ = text;
+
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw_errno("no se puede crear " + path);
+    }
+    std::string content = id_ + "\n";
+    bool ok = ::write(fd, content.data(), content.size()) == static_cast<ssize_t>(content.size()) && fsync(fd) == 0;
+    ::close(fd);
+    if (!ok) {
+        throw_errno("no se puede escribir " + path);
+    }
+    fsync_dir(dir_);
+}
+
+void Spool::recover_tail()
+{
+    // el último segmento puede acabar en un registro a medias si se cortó una escritura
+    Segment &last = segments_.back();
+    std::string data = read_file(last.path, 0, last.bytes);
+    size_t pos = 0;
+    uint64_t expected = last.first_seq;
+    uint64_t seq = 0;
+    while (size_t size = check_record(data, pos, seq)) {
+        if (seq != expected) {
+            break;
+        }
+        pos += size;
+        ++expected;
+    }
+
+    if (pos < data.size()) {
+        log("Spool: " + std::to_string(data.size() - pos) + " bytes finales no válidos en " + last.path +
+            ", se descartan");
+        if (truncate(last.path.c_str(), static_cast<off_t>(pos)) != 0) {
+            throw_errno("no se puede recortar " + last.path);
+        }
+    }
+    last.bytes = pos;
+    next_seq_ = expected;
+
+    active_fd_ = ::open(last.path.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    if (active_fd_ < 0) {
+        throw_errno("no se puede abrir " + last.path);
+    }
+    active_bytes_ = pos;
+}
+
+void Spool::open_segment(uint64_t first_seq)
+{
+    if (active_fd_ >= 0) {
+        ::close(active_fd_);
+        active_fd_ = -1;
+    }
+
+    char name[32];
+    std::snprintf(name, sizeof(name), "%020llu.seg", static_cast<unsigned long long>(first_seq));
+    std::string path = dir_ + "/" + name;
+    active_fd_ = ::open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_APPEND | O_CLOEXEC, 0644);
+    if (active_fd_ < 0) {
+        throw_errno("no se puede crear " + path);
+    }
+    fsync_dir(dir_);
+    active_bytes_ = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    segments_.push_back({first_seq, path, 0});
+    if (segments_.size() == 1) {
+        read_first_ = first_seq;
+        read_offset_ = 0;
+    }
+}
+
+uint64_t Spool::append(std::string_view payload)
+{
+    uint64_t seq = next_seq_++;
+    if (pending_.empty()) {
+        pending_first_ = seq;
+    }
+
+    std::string body;
+    put_le(body, seq, 8);
+    body.append(payload);
+    put_le(pending_, payload.size(), 4);
+    put_le(pending_, crc32(0, body.data(), body.size()), 4);
+    pending_ += body;
+    return seq;
+}
+
+void Spool::sync()
+{
+    if (pending_.empty()) {
+        return;
+    }
+
+    try {
+        if (active_fd_ < 0 || active_bytes_ >= segment_bytes_) {
+            open_segment(pending_first_);
+        }
+        size_t written = 0;
+        while (written < pending_.size()) {
+            ssize_t n = ::write(active_fd_, pending_.data() + written, pending_.size() - written);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0) {
+                throw_errno("error escribiendo el spool");
+            }
+            written += static_cast<size_t>(n);
+        }
+        if (fdatasync(active_fd_) != 0) {
+            throw_errno("error sincronizando el spool");
+        }
+    } catch (...) {
+        // sin confirmar al broker: los vuelve a enviar y se numeran de nuevo
+        if (active_fd_ >= 0 && ftruncate(active_fd_, static_cast<off_t>(active_bytes_)) != 0) {
+            log("Spool: no se ha podido recortar el segmento tras el error");
+        }
+        discard_pending();
+        throw;
+    }
+
+    active_bytes_ += pending_.size();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        segments_.back().bytes = active_bytes_;
+        last_seq_ = next_seq_ - 1;
+        ++syncs_;
+    }
+    ready_.notify_all();
+    pending_.clear();
+}
+
+void Spool::discard_pending()
+{
+    if (!pending_.empty()) {
+        pending_.clear();
+        next_seq_ = pending_first_;
+    }
+}
+
+void Spool::load_committed(const std::vector<std::pair<uint64_t, uint64_t>> &ranges)
+{
+    std::vector<std::pair<uint64_t, uint64_t>> sorted = ranges;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto &[first, last] : sorted) {
+        // un rango por encima de lo que hay en disco es de otra instalación del spool
+        mark_done_locked(first, std::min(last, std::max(last_seq_, watermark_)));
+    }
+    compacted_ = std::min(compacted_, watermark_);
+    stats_watermark_ = watermark_;
+    release_locked();
+}
+
+bool Spool::read_record(const Segment &segment, Record &record, std::unique_lock<std::mutex> &lock)
+{
+    uint64_t seq = 0;
+    size_t pos = read_offset_ - buf_start_;
+    if (read_offset_ < buf_start_ || pos > read_buf_.size() || !check_record(read_buf_, pos, seq)) {
+        if (read_offset_ >= segment.bytes) {
+            return false;
+        }
+        // nuevo bloque desde la posición de lectura, fuera del cerrojo
+        std::string path = segment.path;
+        uint64_t size = std::min<uint64_t>(segment.bytes - read_offset_, READ_CHUNK);
+        lock.unlock();
+        read_buf_ = read_file(path, read_offset_, size);
+        if (read_buf_.size() >= HEADER_BYTES) {
+            uint64_t needed = HEADER_BYTES + get_le(read_buf_.data(), 4);
+            if (needed > read_buf_.size()) {
+                read_buf_ = read_file(path, read_offset_, needed);
+            }
+        }
+        lock.lock();
+        buf_start_ = read_offset_;
+        pos = 0;
+        if (!check_record(read_buf_, pos, seq)) {
+            // registro dañado: el resto del segmento no se puede leer
+            log("Spool: registro dañado en " + path + ", se salta el resto del segmento");
+            read_offset_ = UINT64_MAX;
+            read_buf_.clear();
+            return false;
+        }
+    }
+
+    size_t size = HEADER_BYTES + get_le(read_buf_.data() + pos, 4);
+    record.seq = seq;
+    record.payload.assign(read_buf_, pos + HEADER_BYTES, size - HEADER_BYTES);
+    read_offset_ += size;
+    read_seq_ = seq;
+    return true;
+}
+
+bool Spool::next(Record &record)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        if (closed_) {
+            return false;
+        }
+
+        auto it = std::find_if(segments_.begin(), segments_.end(),
+                               [this](const Segment &s) { return s.first_seq == read_first_; });
+        if (it != segments_.end()) {
+            Segment segment = *it;
+            if (read_record(segment, record, lock)) {
+                return true;
+            }
+            it = std::find_if(segments_.begin(), segments_.end(),
+                              [this](const Segment &s) { return s.first_seq == read_first_; });
+        }
+
+        auto later = std::find_if(segments_.begin(), segments_.end(),
+                                  [this](const Segment &s) { return s.first_seq > read_first_; });
+        bool finished = it == segments_.end() || read_offset_ >= it->bytes;
+        if (finished && later != segments_.end()) {
+            // los mensajes que faltan entre segmentos se perdieron (registro dañado)
+            if (later->first_seq > read_seq_ + 1) {
+                mark_done_locked(read_seq_ + 1, later->first_seq - 1);
+            }
+            read_first_ = later->first_seq;
+            read_offset_ = 0;
+            read_seq_ = later->first_seq - 1;
+            read_buf_.clear();
+            buf_start_ = 0;
+            release_locked();
+            continue;
+        }
+
+        ready_.wait(lock);
+    }
+}
+
+void Spool::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    ready_.notify_all();
+}
+
+bool Spool::is_done(uint64_t seq) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return seq <= watermark_ || done_.count(seq) > 0;
+}
+
+void Spool::done(const std::vector<uint64_t> &seqs)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (uint64_t seq : seqs) {
+        mark_done_locked(seq, seq);
+    }
+    release_locked();
+}
+
+void Spool::mark_done_locked(uint64_t first, uint64_t last)
+{
+    if (last < first || last <= watermark_) {
+        return;
+    }
+    if (first <= watermark_ + 1) {
+        watermark_ = last;
+    } else {
+        for (uint64_t seq = first; seq <= last; ++seq) {
+            done_.insert(seq);
+        }
+    }
+    while (!done_.empty() && *done_.begin() <= watermark_ + 1) {
+        watermark_ = std::max(watermark_, *done_.begin());
+        done_.erase(done_.begin());
+    }
+}
+
+void Spool::release_locked()
+{
+    // se borran los segmentos ya leídos cuyos mensajes están todos hechos;
+    // el activo se conserva porque guarda el último número de secuencia
+    while (segments_.size() > 1 && segments_[1].first_seq - 1 <= watermark_ &&
+           segments_.front().first_seq < read_first_) {
+        if (unlink(segments_.front().path.c_str()) != 0) {
+            log("Spool: no se ha podido borrar " + segments_.front().path + ": " + std::strerror(errno));
+        }
+        segments_.pop_front();
+    }
+}
+
+std::optional<uint64_t> Spool::take_compaction()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (watermark_ < compacted_ + COMPACT_EVERY) {
+        return std::nullopt;
+    }
+    compacted_ = watermark_;
+    return watermark_;
+}
+
+std::string Spool::take_stats()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto now = Clock::now();
+    double seconds = std::max(std::chrono::duration<double>(now - last_stats_).count(), 1e-3);
+    uint64_t bytes = 0;
+    for (const Segment &segment : segments_) {
+        bytes += segment.bytes;
+    }
+
+    char text[200];
+    std::snprintf(text, sizeof(text),
+                  "spool %llu mensajes pendientes (%.1f MB en %zu segmentos), %.1f msg/s guardados, "
+                  "%.1f msg/s drenados, %llu fsync",
+                  static_cast<unsigned long long>(last_seq_ > watermark_ ? last_seq_ - watermark_ : 0),
+                  bytes / 1e6, segments_.size(), (last_seq_ - stats_seq_) / seconds,
+                  (watermark_ - stats_watermark_) / seconds, static_cast<unsigned long long>(syncs_));
+
+    last_stats_ = now;
+    stats_seq_ = last_seq_;
+    stats_watermark_ = watermark_;
+    syncs_ = 0;
+    return text;
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "payload.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// registro local de los mensajes recibidos, en segmentos a los que solo se
+// añade al final. El hilo MQTT guarda cada mensaje con append() y llama a
+// sync() antes de confirmarlos al broker; el drenador los lee en orden con
+// next() y los escritores marcan con done() los que ya están en PostgreSQL
+// (o descartados). Los segmentos con todos sus mensajes hechos se borran.
+class Spool {
+public:
+    struct Record {
+        uint64_t seq = 0;
+        std::string payload;
+    };
+
+    // abre o crea el directorio y recupera el último segmento; lanza std::runtime_error
+    Spool(std::string dir, size_t segment_bytes);
+    ~Spool();
+
+    Spool(const Spool &) = delete;
+    Spool &operator=(const Spool &) = delete;
+
+    // identificador del spool en ingest_spool, guardado en el propio directorio
+    const std::string &id() const { return id_; }
+
+    // solo desde el hilo MQTT: append() asigna el número de secuencia y sync()
+    // escribe y hace fdatasync de todo lo añadido desde la llamada anterior
+    uint64_t append(std::string_view payload);
+    void sync();
+    // descarta lo añadido desde el último sync(): al caer la sesión MQTT esos
+    // mensajes no se han confirmado y el broker los vuelve a enviar
+    void discard_pending();
+
+    // rangos [first, last] que ingest_spool da por escritos en PostgreSQL
+    void load_committed(const std::vector<std::pair<uint64_t, uint64_t>> &ranges);
+
+    // siguiente mensaje sincronizado en orden de secuencia; espera si no hay.
+    // false tras close(): lo que quede sin leer se lee en el próximo arranque
+    bool next(Record &record);
+    void close();
+
+    bool is_done(uint64_t seq) const;
+    void done(const std::vector<uint64_t> &seqs);
+
+    // marca de agua (todo lo anterior está hecho) cuando ha avanzado lo
+    // bastante desde la última compactación de ingest_spool
+    std::optional<uint64_t> take_compaction();
+
+    // mensajes pendientes, tamaño en disco y ritmos desde la última llamada
+    std::string take_stats();
+
+private:
+    struct Segment {
+        uint64_t first_seq;
+        std::string path;
+        uint64_t bytes;   // bytes sincronizados, siempre en límite de registro
+    };
+
+    void load_id();
+    void recover_tail();
+    void open_segment(uint64_t first_seq);
+    bool read_record(const Segment &segment, Record &record, std::unique_lock<std::mutex> &lock);
+    void mark_done_locked(uint64_t first, uint64_t last);
+    void release_locked();
+
+    const std::string dir_;
+    const size_t segment_bytes_;
+    std::string id_;
+
+    // hilo MQTT
+    int active_fd_ = -1;
+    uint64_t active_bytes_ = 0;
+    uint64_t next_seq_ = 1;
+    std::string pending_;
+    uint64_t pending_first_ = 0;
+
+    // drenador
+    uint64_t read_first_ = 0;    // segmento en lectura
+    uint64_t read_offset_ = 0;
+    uint64_t read_seq_ = 0;      // último leído
+    std::string read_buf_;
+    uint64_t buf_start_ = 0;     // posición en el segmento de read_buf_[0]
+
+    mutable std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<Segment> segments_;
+    uint64_t last_seq_ = 0;      // último sincronizado
+    uint64_t watermark_ = 0;     // todo lo anterior o igual está hecho
+    std::set<uint64_t> done_;    // hechos por encima de la marca de agua
+    uint64_t compacted_ = 0;
+    bool closed_ = false;
+
+    Clock::time_point last_stats_ = Clock::now();
+    uint64_t stats_seq_ = 0;
+    uint64_t stats_watermark_ = 0;
+    uint64_t syncs_ = 0;
+};
@@ -1,5 +1,8 @@
 from flask import Flask, request, jsonify
+import numpy as np
 import psycopg2
+import psycopg2.errors
+from seguimiento_tags import predecir
 
 app = Flask(__name__)
 
@@ -11,6 +14,14 @@ db_params = {
     'port': 5432
 }
 
+# calidad de la última posición de cada tag: hora de la medida más reciente, su
+# antigüedad, anchors usados, RMS de los residuos y elipse de error a 1σ
+COLUMNAS_POSICION = """positionx, positiony, positionz, floor, fix_ts,
+    EXTRACT(EPOCH FROM now() - fix_ts), fix_n_anchors, fix_rms_m, fix_major_m, fix_minor_m, fix_angle_deg"""
+
+# la pista de un tag se extrapola como mucho este tiempo (s) desde su última distancia
+PREDICCION_MAX_S = 5.0
+
 @app.get('/device_position')
 def get_device_position():
 
@@ -30,22 +41,36 @@ def get_device_position():
 
         # consulta SQL según el parámetro de entrada
         if mac:
-            query = "SELECT positionx, positiony FROM devices WHERE mac = %s;"
+            query = f"SELECT {COLUMNAS_POSICION} FROM devices WHERE mac = %s;"
             cursor.execute(query, (mac,))
         elif device_id:
-            query = "SELECT positionx, positiony FROM devices WHERE id = %s;"
+            query = f"SELECT {COLUMNAS_POSICION} FROM devices WHERE id = %s;"
             cursor.execute(query, (device_id,))
         elif num_device:
-            query = "SELECT positionx, positiony FROM devices OFFSET %s LIMIT 1;"
+            query = f"SELECT {COLUMNAS_POSICION} FROM devices OFFSET %s LIMIT 1;"
             cursor.execute(query, (int(num_device) - 1,))  # índice de fila desde 1
 
         result = cursor.fetchone() # resultado de la consulta
         if result:
-            positionx, positiony = result
-            return jsonify({'positionx': positionx, 'positiony': positiony}), 200
+            positionx, positiony, positionz, floor, ts, age, n_anchors, rms, major, minor, angle = result
+            # positionz y floor son null sin modo 3D ni plantas asignadas, y la calidad
+            # en los anchors y en los tags que aún no tienen posición
+            ellipse = None if major is None else {'major_m': major, 'minor_m': minor, 'angle_deg': angle}
+            return jsonify({'positionx': positionx, 'positiony': positiony,
+                            'positionz': positionz, 'floor': floor,
+                            'ts': ts.isoformat() if ts else None,
+                            'age_s': round(float(age), 1) if age is not None else None,
+                            'n_anchors': n_anchors, 'rms_m': rms,
+                            # error medio cuadrático de la posición: raíz de la traza de la covarianza
+                            'error_m': round(float(np.hypot(major, minor)), 3) if major is not None else None,
+                            'ellipse': ellipse}), 200
         else:
             return jsonify({'error': 'No se ha encontrado el dispositivo consultado'}), 404
 
+    except psycopg2.errors.InvalidTextRepresentation:
+        # mac (macaddr) o id con un formato que PostgreSQL no acepta
+        return jsonify({'error': 'Parámetro de consulta no válido'}), 400
+
     except psycopg2.Error as e:
         print(f"Error de la base de datos: {e}")
         return jsonify({'error': 'Error de la conexión a la base de datos'}), 500
@@ -57,5 +82,109 @@ def get_device_position():
         if conn:
             conn.close()
 
+@app.get('/tag_track')
+def get_tag_track():
+
+    # parámetros de consulta : mac o id del tag, y ts (ISO 8601) opcional; sin ts se
+    # predice para la hora actual de la base de datos
+    mac = request.args.get('mac')
+    device_id = request.args.get('id')
+    ts = request.args.get('ts')
+
+    if not mac and not device_id:
+        return jsonify({'error': 'No se ha consultado por mac o id como parámetro'}), 400
+
+    conn = cursor = None
+    try:
+        conn = psycopg2.connect(**db_params)
+        cursor = conn.cursor()
+
+        # estado guardado por calcular_localizacion y segundos hasta la hora consultada
+        cursor.execute("""
+            SELECT t.ts, q.ts, extract(epoch FROM q.ts - t.ts),
+                   t.positionx, t.positiony, t.velocityx, t.velocityy, t.covariance, t.process_noise
+            FROM tag_tracks t
+            JOIN devices d ON d.id = t.id_tag
+            CROSS JOIN (SELECT coalesce(%s::timestamptz, now()) AS ts) q
+            WHERE d.mac = %s OR d.id = %s
+            LIMIT 1;
+        """, (ts, mac, device_id))
+
+        result = cursor.fetchone()
+        if not result:
+            return jsonify({'error': 'No hay pista del tag consultado'}), 404
+
+        last_ts, query_ts, dt, px, py, vx, vy, covariance, q = result
+        dt = min(float(dt), PREDICCION_MAX_S)
+        x, P = predecir(np.array([[px, py, vx, vy]]), np.array(covariance).reshape(1, 4, 4),
+                        np.array([q]), np.array([dt]))
+        return jsonify({
+            'ts': query_ts.isoformat(),
+            'last_update': last_ts.isoformat(),
+            'positionx': x[0, 0], 'positiony': x[0, 1],
+            'velocityx': x[0, 2], 'velocityy': x[0, 3],
+            'covariance': P[0].tolist(),  # orden x, y, vx, vy
+            'extrapolated_s': max(dt, 0.0),
+        }), 200
+
+    except (psycopg2.errors.InvalidTextRepresentation, psycopg2.errors.InvalidDatetimeFormat,
+            psycopg2.errors.DatetimeFieldOverflow):
+        # mac, id o ts con un formato que PostgreSQL no acepta
+        return jsonify({'error': 'Parámetro de consulta no válido'}), 400
+
+    except psycopg2.Error as e:
+        print(f"Error de la base de datos: {e}")
+        return jsonify({'error': 'Error de la conexión a la base de datos'}), 500
+
+    finally:
+        if cursor:
+            cursor.close()
+        if conn:
+            conn.close()
+
+@app.get('/pair_stats')
+def get_pair_stats():
+
+    # parámetros de consulta : mac o id del tag; devuelve una entrada por anchor
+    mac = request.args.get('mac')
+    device_id = request.args.get('id')
+
+    if not mac and not device_id:
+        return jsonify({'error': 'No se ha consultado por mac o id como parámetro'}), 400
+
+    conn = cursor = None
+    try:
+        conn = psycopg2.connect(**db_params)
+        cursor = conn.cursor()
+
+        # estadísticas acumuladas por la ingesta de cada par (tag, anchor)
+        cursor.execute("""
+            SELECT a.mac::text, p.n, p.sum_cm / p.n,
+                   sqrt(greatest(p.sumsq_cm / p.n - (p.sum_cm / p.n) ^ 2, 0)), p.last_cm, p.last_ts
+            FROM pair_stats p
+            JOIN devices t ON t.id = p.id_src
+            JOIN devices a ON a.id = p.id_dst
+            WHERE t.mac = %s OR t.id = %s
+            ORDER BY a.mac;
+        """, (mac, device_id))
+
+        return jsonify([{'anchor': anchor, 'n': n, 'mean_cm': mean, 'std_cm': std,
+                         'last_cm': last_cm, 'last_ts': last_ts.isoformat()}
+                        for anchor, n, mean, std, last_cm, last_ts in cursor.fetchall()]), 200
+
+    except psycopg2.errors.InvalidTextRepresentation:
+        # mac o id con un formato que PostgreSQL no acepta
+        return jsonify({'error': 'Parámetro de consulta no válido'}), 400
+
+    except psycopg2.Error as e:
+        print(f"Error de la base de datos: {e}")
+        return jsonify({'error': 'Error de la conexión a la base de datos'}), 500
+
+    finally:
+        if cursor:
+            cursor.close()
+        if conn:
+            conn.close()
+
 if __name__ == '__main__':
     app.run(host="0.0.0.0", port=5000, debug=True)
@@ -1,18 +1,97 @@
 import sys
 import psycopg2
 import numpy as np
-import pandas as pd
 import time
+import select
 import os
-sys.path.insert(0, os.path.dirname(os.path.abspath(__file__))) 
-from resolver_trilateracion import resolver_trilateracion
+from collections import defaultdict, deque
+from datetime import timedelta
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from psycopg2.extras import execute_values
 from contextlib import contextmanager
+from resolver_trilateracion import GeometriaAnclas, MIN_ANCLAS, elipse_error, resolver_multilateracion as resolver_numpy
+from indice_anclas import IndiceAnclas, CANDIDATAS_MAX, planta_por_altura
+from seguimiento_tags import SeguimientoTags, RUIDO_PROCESO, CLASE_DEFECTO, PISTA_CADUCA_S
+from planificar_medidas import RangingPlanner, SIGMA_DEFECTO_M
+# multilateración robusta (Levenberg-Marquardt con Huber, RANSAC y rechazo de
+# anchors) en C++ si está compilada libftm_multilat; si no, numpy
+try:
+    from multilateracion_nativa import resolver_multilateracion
+    SOLVER = 'robusto'
+except ImportError:
+    from resolver_trilateracion import resolver_multilateracion
+    SOLVER = 'robusto_numpy'
+try:
+    from multilateracion_nativa import PlanoPlanta, FiltroParticulas
+except ImportError:
+    PlanoPlanta = FiltroParticulas = None
+
+# ventana de medidas de cada par (tag, anchor): las de los últimos VENTANA_S
+# segundos, hasta VENTANA_MUESTRAS
+VENTANA_S = 30
+VENTANA_MUESTRAS = 50
+# solape de cada lectura con la anterior, para no perder filas de transacciones
+# que confirman después de otras más recientes
+SOLAPE_LECTURA_S = 5
+# devices se relee si aparece un id desconocido o pasado este tiempo
+RECARGA_DISPOSITIVOS_S = 60
+# tras la primera notificación se esperan las de la misma ráfaga antes de recalcular
+AGRUPACION_S = 0.1
+# sin notificaciones se lee data_tag igualmente pasado este tiempo
+ESPERA_MAX_S = 30
+# localización con filtro de partículas (opcional): si existe el plano PLANO_PGM
+# (paredes en negro) y está compilada libftm_multilat, cada tag tiene un filtro
+# que funde sus distancias sueltas con el plano, y su estimación sustituye a la
+# posición de la multilateración
+PLANO_PGM = os.environ.get('FTM_PLANO_PGM', os.path.join(os.path.dirname(os.path.abspath(__file__)), 'plano.pgm'))
+PLANO_RESOLUCION_M = 0.05
+PLANO_ORIGEN = (0.0, 0.0)
+PARTICULAS_POR_TAG = 5000
+# RMS (m) de los residuos de la estimación a partir del cual el filtro se reinicia
+# con la posición de la multilateración
+PARTICULAS_RMS_REINICIO_M = 1.5
+# planes de medida por tag (planificar_medidas.py) con los anchors que el tag ha medido
+# en los últimos VISIBILIDAD_S; el tag mide todos cada RONDAS_COMPLETAS rondas de
+# PERIODO_RONDA_MS (5 min con la configuración del firmware)
+PLANES_MEDIDA = True
+VISIBILIDAD_S = 600
+# modo 3D: si todos los anchors tienen altura (devices.positionz) y entre el más bajo
+# y el más alto hay al menos DISPERSION_Z_MIN_M, los tags se resuelven en 3D con los
+# anchors de todas las plantas de su zona (con numpy: libftm_multilat es 2D) y la
+# planta de cada posición sale de su altura (indice_anclas.planta_por_altura)
+DISPERSION_Z_MIN_M = 1.0
+SOLVER_3D = 'robusto_3d'
 
 class PositionCalculator:
-    
+
     def __init__(self, db_config):
         self.db_config = db_config
-        
+        self.windows = defaultdict(lambda: deque(maxlen=VENTANA_MUESTRAS))
+        self.last_ts = None
+        self.seen_ids = {}
+        self.anchors = {}
+        self.anchor_areas = {}
+        self.anchor_index = IndiceAnclas({})
+        self.anchor_rows = {}
+        self.geometry = GeometriaAnclas([])
+        self.anchor_heights = {}
+        self.geometry_3d = None
+        self.last_heights = {}
+        self.tag_anchors = defaultdict(set)
+        self.last_positions = {}
+        self.tracker = SeguimientoTags()
+        self.motion_classes = {}
+        self.plan = None
+        self.particle_filters = {}
+        if FiltroParticulas is not None and os.path.exists(PLANO_PGM):
+            self.plan = PlanoPlanta.desde_pgm(PLANO_PGM, PLANO_RESOLUCION_M, PLANO_ORIGEN)
+        self.ranging_planner = RangingPlanner()
+        self.last_seen = {}
+        self.macs = {}
+        self.tags = set()
+        self.known_ids = set()
+        self.devices_loaded_at = 0
+
     @contextmanager
     def get_db_connection(self):
         conn = psycopg2.connect(**self.db_config)
@@ -20,99 +99,448 @@ class PositionCalculator:
             yield conn
         finally:
             conn.close()
-               
-    def get_table_data(self, cursor):
-        """se obtienen los datos de las tablas devices y data_tag"""
-        cursor.execute('SELECT id, mac, id_type, positionx, positiony FROM devices')
-        
-        devices = pd.DataFrame(cursor.fetchall(), 
-			columns=['id', 'mac', 'id_type', 'positionx', 'positiony'])
-        
-        cursor.execute('SELECT id, id_src, id_dst, distance_cm, rtt_ns FROM data_tag')
-        
-        data_tag = pd.DataFrame(cursor.fetchall(), 
-			columns=['id', 'id_src', 'id_dst', 'distance_cm', 'rtt_ns'])
-        
-        data_tag = data_tag.dropna(subset=['id', 'id_src', 'id_dst', 'distance_cm'])
-        
-        return devices, data_tag
-        
-    def calculate_distances(self, data_tag, tag_ids, anchor_ids):
-        """Se calcula la matriz de distancias promedio entre tags y anchors de manera optimizada"""
-    
-        filtered_data = data_tag[
-        data_tag['id_src'].isin(tag_ids) & data_tag['id_dst'].isin(anchor_ids)
-        ]
-    
-        grouped = filtered_data.groupby(['id_src', 'id_dst'])['distance_cm'].mean().reset_index()
-        pivot = grouped.pivot(index='id_src', columns='id_dst', values='distance_cm')
-        pivot = pivot.reindex(index=tag_ids, columns=anchor_ids)
-        
-        distances_cm = pivot.values
+
+    def get_devices(self, cursor):
+        """se obtienen los anchors (con su posición) y los tags de la tabla devices"""
+        cursor.execute('SELECT id, id_type, positionx, positiony, positionz, motion_class, upper(mac::text), '
+                       'zone, floor FROM devices ORDER BY id')
+
+        anchors = {}
+        areas = {}
+        heights = {}
+        self.tags = set()
+        self.known_ids = set()
+        self.macs = {}
+        for device_id, id_type, x, y, z, motion_class, mac, zone, floor in cursor.fetchall():
+            self.known_ids.add(device_id)
+            self.macs[device_id] = mac
+            if id_type == 1 and x is not None and y is not None:
+                anchors[device_id] = (x, y)
+                areas[device_id] = (zone, floor)
+                if z is not None:
+                    heights[device_id] = z
+            elif id_type == 2:
+                self.tags.add(device_id)
+                self.motion_classes[device_id] = motion_class
+                self.tracker.hueco(device_id, motion_class)
+        self.devices_loaded_at = time.monotonic()
+
+        # el índice y la geometría (y sus pseudoinversas) solo se rehacen si cambian los anchors
+        if anchors != self.anchors or areas != self.anchor_areas or heights != self.anchor_heights:
+            self.anchors = anchors
+            self.anchor_areas = areas
+            self.anchor_heights = heights
+            z = list(heights.values())
+            mode_3d = len(heights) == len(anchors) > 0 and max(z) - min(z) >= DISPERSION_Z_MIN_M
+            # en 3D las plantas de una zona se combinan: la planta la da la altura
+            self.anchor_index = IndiceAnclas(anchors, {a: zone for a, (zone, _) in areas.items()},
+                                             None if mode_3d else {a: f for a, (_, f) in areas.items()})
+            self.anchor_rows = {a: i for i, a in enumerate(anchors)}
+            self.geometry = GeometriaAnclas(list(anchors.values()))
+            if mode_3d != (self.geometry_3d is not None):
+                print(f"Modo {'3D' if mode_3d else '2D'}: alturas de los anchors entre "
+                      f"{min(z, default=0):.1f} y {max(z, default=0):.1f} m")
+            self.geometry_3d = GeometriaAnclas([(*anchors[a], heights[a]) for a in anchors]) if mode_3d else None
+
+    def get_new_measurements(self, cursor):
+        """se leen solo las medidas nuevas de data_tag y se añaden a las ventanas;
+        devuelve los tags con medidas nuevas, los dispositivos que aparecen en ellas y
+        las medidas (tag, anchor, distancia en cm, ts, hora de la medida) para el
+        seguimiento. ts es la hora de ingesta (now() del lote que la escribió) y solo
+        sirve para leer de forma incremental; la hora de la medida es la del tag
+        (ts_device) si está sincronizado, sin los retardos de ESP-NOW, MQTT y la ingesta"""
+        if self.last_ts is None:
+            cursor.execute("""
+                SELECT id, id_src, id_dst, distance_cm, ts, COALESCE(ts_device, ts) FROM data_tag
+                WHERE ts > now() - %s * interval '1 second'
+                ORDER BY ts, id
+            """, (VENTANA_S,))
+        else:
+            cursor.execute("""
+                SELECT id, id_src, id_dst, distance_cm, ts, COALESCE(ts_device, ts) FROM data_tag
+                WHERE ts > %s
+                ORDER BY ts, id
+            """, (self.last_ts - timedelta(seconds=SOLAPE_LECTURA_S),))
+
+        dirty = set()
+        devices = set()
+        ranges = []
+        for row_id, id_src, id_dst, distance_cm, ts, t in cursor.fetchall():
+            if row_id in self.seen_ids or id_src is None or id_dst is None or distance_cm is None:
+                continue
+            self.seen_ids[row_id] = ts
+            self.windows[(id_src, id_dst)].append((ts, distance_cm, t))
+            self.tag_anchors[id_src].add(id_dst)
+            self.last_seen[(id_src, id_dst)] = ts
+            ranges.append((id_src, id_dst, distance_cm, ts, t))
+            self.last_ts = ts if self.last_ts is None else max(self.last_ts, ts)
+            dirty.add(id_src)
+            devices.update((id_src, id_dst))
+
+        # solo hace falta recordar las filas que puede volver a traer el solape
+        if self.last_ts is not None:
+            horizon = self.last_ts - timedelta(seconds=SOLAPE_LECTURA_S)
+            self.seen_ids = {i: ts for i, ts in self.seen_ids.items() if ts > horizon}
+
+        return dirty, devices, ranges
+
+    def calculate_distances(self, tag_id, anchor_ids):
+        """Se calcula la distancia promedio del tag a cada anchor dentro de la ventana,
+        la varianza de ese promedio y la hora de la medida más reciente"""
+        cutoff = self.last_ts - timedelta(seconds=VENTANA_S)
+        distances_cm = np.full(len(anchor_ids), np.nan)
+        variances_cm2 = np.full(len(anchor_ids), np.nan)
+        latest = None
+
+        for i, anchor_id in enumerate(anchor_ids):
+            window = self.windows.get((tag_id, anchor_id))
+            if not window:
+                continue
+            while window and window[0][0] < cutoff:
+                window.popleft()
+            if window:
+                samples = np.array([d for _, d, _ in window])
+                distances_cm[i] = samples.mean()
+                if len(samples) > 1:
+                    variances_cm2[i] = samples.var(ddof=1) / len(samples)
+                latest = window[-1][2] if latest is None else max(latest, window[-1][2])
+
         distances_m = distances_cm / 100.0
-    
-        return distances_m
-    
-    def update_tag_positions(self, cursor, tag_ids, positions):
-        """se actualizan las posiciones de los tags en la base de datos"""
-        for tag_id, (x, y) in zip(tag_ids, positions):
-            if not (np.isnan(x) or np.isnan(y)):
-                x_rounded = float(round(float(x), 2))
-                y_rounded = float(round(float(y), 2))
-                tag_id_int = int(tag_id)
-                
-                cursor.execute("""				
-                    UPDATE devices 
-                    SET positionx = %s, positiony = %s 
-                    WHERE id = %s AND id_type = 2
-                """, (x_rounded, y_rounded, tag_id_int))
-    
+        variances_m2 = variances_cm2 / 10000.0
+
+        return distances_m, variances_m2, latest
+
+    def reported_anchors(self, tag_id):
+        """anchors con medidas del tag en la ventana y la última distancia (m) a cada
+        uno; los pares que se quedan sin medidas se olvidan"""
+        cutoff = self.last_ts - timedelta(seconds=VENTANA_S)
+        reported = {}
+        for anchor_id in list(self.tag_anchors.get(tag_id, ())):
+            window = self.windows.get((tag_id, anchor_id))
+            while window and window[0][0] < cutoff:
+                window.popleft()
+            if window:
+                reported[anchor_id] = window[-1][1] / 100.0
+            else:
+                self.windows.pop((tag_id, anchor_id), None)
+                self.tag_anchors[tag_id].discard(anchor_id)
+        return reported
+
+    def solve(self, tag_ids):
+        """cada tag se resuelve solo con sus anchors candidatos (IndiceAnclas), en un
+        lote de tags × CANDIDATAS_MAX con los índices de sus anchors en la geometría,
+        así que la memoria y el cálculo crecen con las medidas y no con tags × anchors.
+        En modo 3D, los tags que no tienen solución en 3D (sus anchors están casi a la
+        misma altura) se resuelven en 2D. Devuelve la Solucion en el plano (con los ids
+        de los anchors rechazados de cada tag en rechazados y los residuos solo de los
+        anchors usados), la hora de la medida más reciente, la altura (NaN sin solución
+        3D) y la planta de cada tag"""
+        n = len(tag_ids)
+        indices = np.full((n, CANDIDATAS_MAX), -1, dtype=np.int32)
+        distances = np.full((n, CANDIDATAS_MAX), np.nan)
+        variances = np.full((n, CANDIDATAS_MAX), np.nan)
+        candidates = []
+        timestamps = []
+        for i, tag_id in enumerate(tag_ids):
+            subset = self.anchor_index.candidatos(self.reported_anchors(tag_id), self.last_positions.get(tag_id))
+            k = len(subset)
+            indices[i, :k] = [self.anchor_rows[a] for a in subset]
+            distances[i, :k], variances[i, :k], latest = self.calculate_distances(tag_id, subset)
+            candidates.append(subset)
+            timestamps.append(latest)
+
+        heights = np.full(n, np.nan)
+        if self.geometry_3d is None:
+            solution = resolver_multilateracion(self.geometry, distances, variances, indices)
+            floors = [self.anchor_index.plantas.get(subset[0]) if subset else None for subset in candidates]
+        else:
+            solution = resolver_numpy(self.geometry_3d, distances, variances, indices)
+            heights = solution.posiciones[:, 2].copy()
+            solution = solution._replace(posiciones=solution.posiciones[:, :2].copy(),
+                                         covarianzas=solution.covarianzas[:, :2, :2].copy())
+            measured = ((indices >= 0) & np.isfinite(distances)).sum(axis=1)
+            flat = ~np.isfinite(heights) & (measured >= MIN_ANCLAS)
+            if flat.any():
+                plane = resolver_multilateracion(self.geometry, distances[flat], variances[flat], indices[flat])
+                for field, values in zip(solution, plane):
+                    field[flat] = values
+            # sin altura propia, la planta es la de la altura media de sus anchors
+            anchor_z = np.array([np.mean([self.anchor_heights[a] for a in subset]) if subset else np.nan
+                                 for subset in candidates])
+            floors = [None if np.isnan(f) else int(f)
+                      for f in planta_por_altura(np.where(np.isfinite(heights), heights, anchor_z))]
+
+        rejected = [[int(subset[k]) for k in np.flatnonzero(r[:len(subset)])]
+                    for subset, r in zip(candidates, solution.rechazados)]
+        for tag_id, p, z in zip(tag_ids, solution.posiciones, heights):
+            if np.all(np.isfinite(p)):
+                self.last_positions[tag_id] = tuple(p)
+                if np.isfinite(z):
+                    self.last_heights[tag_id] = z
+        residuals = np.where(solution.rechazados, np.nan, solution.residuos)
+        return solution._replace(residuos=residuals, rechazados=rejected), timestamps, heights, floors
+
+    def update_tag_positions(self, cursor, fixes):
+        """se guardan las posiciones en tag_positions y se actualiza la última de cada
+        tag en devices, con su calidad (hora, anchors usados, RMS de los residuos y
+        elipse de error a 1σ), todo en una sola sentencia"""
+        def optional(value, decimals):
+            return float(round(float(value), decimals)) if np.isfinite(value) else None
+
+        covariances = np.array([cov for *_, cov, _, _, _, _ in fixes]).reshape(-1, 2, 2)
+        rows = []
+        for (tag_id, ts, x, y, z, floor, cov, n_anchors, rms, rejected, solver), major, minor, angle in zip(
+                fixes, *elipse_error(covariances)):
+            if np.isnan(x) or np.isnan(y):
+                continue
+            cov_xx, cov_xy, cov_yy = (None, None, None) if not np.all(np.isfinite(cov)) else \
+                (float(cov[0, 0]), float(cov[0, 1]), float(cov[1, 1]))
+            rows.append((int(tag_id), ts, float(round(float(x), 2)), float(round(float(y), 2)),
+                         optional(z, 2), floor, cov_xx, cov_xy, cov_yy, int(n_anchors), optional(rms, 3),
+                         rejected, solver, optional(major, 3), optional(minor, 3), optional(angle, 1)))
+        if not rows:
+            return 0
+
+        # sin altura (modo 2D) se conserva la última en devices
+        execute_values(cursor, """
+            WITH fixes (id_tag, ts, positionx, positiony, positionz, floor, cov_xx, cov_xy, cov_yy, n_anchors, rms_m,
+                        rejected_anchors, solver, major_m, minor_m, angle_deg) AS (
+                VALUES %s
+            ), historial AS (
+                INSERT INTO tag_positions (id_tag, ts, positionx, positiony, positionz, floor, cov_xx, cov_xy, cov_yy, n_anchors, rms_m, rejected_anchors, solver)
+                SELECT id_tag, ts, positionx, positiony, positionz, floor, cov_xx, cov_xy, cov_yy, n_anchors, rms_m, rejected_anchors, solver
+                FROM fixes
+            )
+            UPDATE devices d
+            SET positionx = f.positionx, positiony = f.positiony,
+                positionz = COALESCE(f.positionz, d.positionz), floor = COALESCE(f.floor, d.floor),
+                fix_ts = f.ts, fix_n_anchors = f.n_anchors, fix_rms_m = f.rms_m,
+                fix_major_m = f.major_m, fix_minor_m = f.minor_m, fix_angle_deg = f.angle_deg
+            FROM fixes f
+            WHERE d.id = f.id_tag AND d.id_type = 2
+        """, rows,
+            template='(%s::integer, %s::timestamptz, %s::float8, %s::float8, %s::float8, %s::smallint, %s::float8, %s::float8, %s::float8, '
+                     '%s::smallint, %s::real, %s::integer[], %s::varchar, %s::real, %s::real, %s::real)',
+            page_size=len(rows))
+        return len(rows)
+
+    def pair_variance(self, tag, anchor):
+        """varianza (m²) de una medida suelta del par a partir de las diferencias entre
+        muestras consecutivas, que no crece con el desplazamiento del tag como la
+        varianza de la ventana; NaN con menos de tres muestras"""
+        samples = np.array([d for _, d, _ in self.windows.get((tag, anchor), ())])
+        return np.mean(np.diff(samples)**2) / 2 / 10000.0 if len(samples) > 2 else np.nan
+
+    def range_variances(self, ranges):
+        """varianza (m²) de cada medida suelta"""
+        variances = {}
+        for tag, anchor, *_ in ranges:
+            if (tag, anchor) not in variances:
+                variances[(tag, anchor)] = self.pair_variance(tag, anchor)
+        return [variances[(tag, anchor)] for tag, anchor, *_ in ranges]
+
+    def plan_ranging(self, tag_ids, solution, rejected):
+        """se recalcula el plan de medida de los tags con posición nueva y se publican
+        los que cambian; los anchors rechazados como NLOS en el último cálculo no entran"""
+        horizon = self.last_ts - timedelta(seconds=VISIBILIDAD_S)
+        self.last_seen = {pair: ts for pair, ts in self.last_seen.items() if ts > horizon}
+        visible = defaultdict(dict)
+        for tag, anchor in self.last_seen:
+            variance = self.pair_variance(tag, anchor)
+            visible[tag][anchor] = np.sqrt(variance) if np.isfinite(variance) else SIGMA_DEFECTO_M
+        for tag_id, r in zip(tag_ids, rejected):
+            for anchor in r:
+                visible[tag_id].pop(anchor, None)
+
+        plans = self.ranging_planner.update(tag_ids, solution.posiciones, self.anchors, visible, self.macs,
+                                            time.monotonic())
+        for tag_id, (plan, error) in sorted(plans.items()):
+            print(f"Tag {tag_id}: plan de medida {list(plan)} ({len(plan)} de {len(visible[tag_id])} anchors, "
+                  f"error esperado {error:.2f} m)")
+
+    def horizontal_ranges(self, ranges):
+        """en modo 3D, la distancia en el plano de cada medida suelta con la última
+        altura del tag, para el seguimiento (que es 2D); si no se conoce, la medida"""
+        if self.geometry_3d is None:
+            return ranges
+        projected = []
+        for tag, anchor, d, ts, t in ranges:
+            z = self.last_heights.get(tag)
+            if z is not None:
+                d = 100.0 * np.sqrt(max((d / 100.0)**2 - (z - self.anchor_heights[anchor])**2, 0.0))
+            projected.append((tag, anchor, d, ts, t))
+        return projected
+
+    def localize_particles(self, ranges, range_variances, tag_ids, timestamps, solution, solvers, rms):
+        """cada tag tiene un filtro de partículas que se inicia con su posición de la
+        multilateración y después se actualiza con sus distancias sueltas. Las de una
+        ronda llegan en el mismo lote (misma ts) y se agrupan en un paso, que se hace a
+        la hora de la medida más reciente del grupo; su estimación sustituye a la
+        posición de la multilateración"""
+        by_tag = defaultdict(lambda: defaultdict(list))
+        for (tag, anchor, d, ts, t), v in zip(ranges, range_variances):
+            by_tag[tag][ts].append((t.timestamp(), *self.anchors[anchor], d / 100.0, v))
+
+        for i, tag_id in enumerate(tag_ids):
+            fix, cov = solution.posiciones[i], solution.covarianzas[i]
+            state = self.particle_filters.get(tag_id)
+            rounds = sorted((max(m[0] for m in group), group) for group in by_tag.get(tag_id, {}).values())
+            stale = state is not None and rounds and rounds[-1][0] - state[1] > PISTA_CADUCA_S
+            if state is None or stale:
+                # las distancias de esta lectura ya están en la posición con la que se inicia
+                if not np.all(np.isfinite(fix)) or timestamps[i] is None:
+                    continue
+                if state is None:
+                    q = RUIDO_PROCESO.get(self.motion_classes.get(tag_id), RUIDO_PROCESO[CLASE_DEFECTO])
+                    state = self.particle_filters[tag_id] = [FiltroParticulas(PARTICULAS_POR_TAG, self.plan, q, tag_id), 0]
+                sigma = np.sqrt(np.trace(cov)) if np.all(np.isfinite(cov)) else 0.5
+                state[0].reiniciar(fix[0], fix[1], max(sigma, 0.1))
+                state[1] = timestamps[i].timestamp()
+                continue
+
+            estimate = None
+            for t, measurements in rounds:
+                m = np.array(measurements)
+                estimate = state[0].paso(max(t - state[1], 0.0), m[:, 1:3], m[:, 3], m[:, 4])
+                state[1] = max(state[1], t)
+            if estimate is None:
+                continue
+            if not estimate.rms <= PARTICULAS_RMS_REINICIO_M:
+                # el filtro se ha perdido: se vuelve a la multilateración
+                if np.all(np.isfinite(fix)):
+                    state[0].reiniciar(fix[0], fix[1], 0.5)
+                continue
+            solution.posiciones[i] = (estimate.x, estimate.y)
+            solution.covarianzas[i] = ((estimate.cov_xx, estimate.cov_xy), (estimate.cov_xy, estimate.cov_yy))
+            solvers[i] = 'particulas'
+            rms[i] = estimate.rms
+
+    def track(self, cursor, ranges, range_variances, tag_ids, timestamps, solution):
+        """las pistas iniciadas se actualizan con cada distancia nueva y las demás se
+        inician con la posición de la multilateración; el estado de cada pista se
+        guarda en tag_tracks para que la API lo prediga a cualquier hora"""
+        if ranges:
+            self.tracker.actualizar(
+                [tag for tag, *_ in ranges],
+                [t.timestamp() for *_, t in ranges],
+                [self.anchors[anchor] for _, anchor, *_ in ranges],
+                [d / 100.0 for _, _, d, *_ in ranges],
+                range_variances)
+        self.tracker.iniciar(tag_ids, [ts.timestamp() if ts else np.nan for ts in timestamps],
+                             solution.posiciones, solution.covarianzas)
+
+        rows = [(int(tag_id), float(t), *map(float, x), [float(c) for c in P.ravel()], float(q))
+                for tag_id, t, x, P, q in self.tracker.pistas(tag_ids)]
+        if not rows:
+            return 0
+        execute_values(cursor, """
+            INSERT INTO tag_tracks (id_tag, ts, positionx, positiony, velocityx, velocityy, covariance, process_noise)
+            VALUES %s
+            ON CONFLICT (id_tag) DO UPDATE
+            SET ts = EXCLUDED.ts, positionx = EXCLUDED.positionx, positiony = EXCLUDED.positiony,
+                velocityx = EXCLUDED.velocityx, velocityy = EXCLUDED.velocityy,
+                covariance = EXCLUDED.covariance, process_noise = EXCLUDED.process_noise
+        """, rows,
+            template='(%s::integer, to_timestamp(%s), %s::float8, %s::float8, %s::float8, %s::float8, %s::float8[], %s::float8)',
+            page_size=len(rows))
+        return len(rows)
+
+    def wait_notifications(self, conn):
+        """se espera a que lleguen medidas nuevas (NOTIFY data_tag_new) y se agrupan
+        las notificaciones de una ráfaga; devuelve los tags notificados"""
+        notified = set()
+        deadline = None
+        while True:
+            if deadline is None:
+                timeout = ESPERA_MAX_S
+            else:
+                timeout = max(0.0, deadline - time.monotonic())
+            if select.select([conn], [], [], timeout) == ([], [], []):
+                return notified
+
+            conn.poll()
+            while conn.notifies:
+                payload = conn.notifies.pop(0).payload
+                notified.update(int(t) for t in payload.split(',') if t)
+            if deadline is None:
+                deadline = time.monotonic() + AGRUPACION_S
+
+    def recalculate(self, cursor, notified):
+        """cálculo de posiciones de los tags con medidas nuevas"""
+        dirty, devices, ranges = self.get_new_measurements(cursor)
+
+        unknown = (devices | notified) - self.known_ids
+        if unknown or time.monotonic() - self.devices_loaded_at > RECARGA_DISPOSITIVOS_S:
+            self.get_devices(cursor)
+
+        if not self.anchors or not self.tags:
+            print("No hay suficientes dispositivos para calcular posiciones")
+            return
+
+        tag_ids = sorted((dirty | notified) & self.tags)
+        if not tag_ids:
+            return
+
+        solution, timestamps, heights, floors = self.solve(tag_ids)
+
+        # distancias sueltas de esta lectura, para el seguimiento y las partículas
+        ranges = [(tag, anchor, d, ts, t) for tag, anchor, d, ts, t in ranges
+                  if tag in self.tags and anchor in self.anchors]
+        range_variances = self.range_variances(ranges)
+        ranges = self.horizontal_ranges(ranges)
+        solvers = [SOLVER_3D if np.isfinite(z) else SOLVER for z in heights]
+        # RMS (m) de los residuos de los anchors usados en cada posición
+        used = np.isfinite(solution.residuos)
+        with np.errstate(divide='ignore', invalid='ignore'):
+            rms = np.sqrt((np.where(used, solution.residuos, 0.0)**2).sum(axis=1) / used.sum(axis=1))
+        # el plano es de una sola planta: en modo 3D no se usan las partículas
+        if self.plan is not None and self.geometry_3d is None:
+            self.localize_particles(ranges, range_variances, tag_ids, timestamps, solution, solvers, rms)
+
+        # ids de los anchors descartados como atípicos (NLOS) en cada tag
+        rejected = solution.rechazados
+        fixes = [(tag_id, ts, x, y, z, floor, cov, n, e, r, solver)
+                 for tag_id, ts, (x, y), z, floor, cov, n, e, r, solver in zip(
+                     tag_ids, timestamps, solution.posiciones, heights, floors, solution.covarianzas,
+                     solution.n_anclas, rms, rejected, solvers)]
+
+        self.update_tag_positions(cursor, fixes)
+        self.track(cursor, ranges, range_variances, tag_ids, timestamps, solution)
+
+        print("Posiciones actualizadas correctamente")
+        print("Posiciones calculadas:", solution.posiciones.tolist())
+        for tag_id, r in zip(tag_ids, rejected):
+            if r:
+                print(f"Tag {tag_id}: anchors rechazados {r}")
+
+        if PLANES_MEDIDA:
+            self.plan_ranging(tag_ids, solution, rejected)
+
     def run(self):
-        """cálculo de posiciones"""
+        """se escucha data_tag_new con una conexión persistente y se recalculan los
+        tags notificados; sin notificaciones se lee igualmente cada ESPERA_MAX_S"""
+        print(f"Resolvedor de posiciones: {SOLVER}")
+        if self.plan is not None:
+            print(f"Filtro de partículas con el plano {PLANO_PGM} ({self.plan.ancho}x{self.plan.alto} celdas)")
         while True:
             try:
                 with self.get_db_connection() as conn:
                     with conn.cursor() as cursor:
-                        
-                        devices_df, data_tag_df = self.get_table_data(cursor)
-                        
-                        anchors = devices_df[devices_df['id_type'] == 1]
-                        tags = devices_df[devices_df['id_type'] == 2]
-                        
-                        if anchors.empty or tags.empty:
-                            print("No hay suficientes dispositivos para calcular posiciones")
-                            time.sleep(3)
-                            continue
-                        
-                        tag_ids = tags['id'].astype(int).values
-                        anchor_ids = anchors['id'].astype(int).values
-                        
-                        distances = self.calculate_distances(
-                            data_tag_df, 
-                            tag_ids,
-                            anchor_ids
-                        )
-                        
-                        positions = []
-                        anchor_positions = anchors[['positionx', 'positiony']].values.astype(float)
-                        
-                        for distances_to_anchors in distances:
-                            x, y = resolver_trilateracion(
-                                anchor_positions[:, 0],
-                                anchor_positions[:, 1],
-                                distances_to_anchors
-                            )
-                            positions.append([x, y])
-                        
-                        self.update_tag_positions(cursor, tag_ids, positions)
+                        cursor.execute('LISTEN data_tag_new')
                         conn.commit()
-                        
-                        print("Posiciones actualizadas correctamente")
-                        print("Posiciones calculadas:", positions)
-                        
+
+                        # lo que haya llegado antes del LISTEN (o durante una reconexión)
+                        # lo recoge la primera lectura
+                        notified = set()
+                        while True:
+                            self.recalculate(cursor, notified)
+                            # fuera de transacción para que se entreguen las notificaciones
+                            conn.commit()
+                            notified = self.wait_notifications(conn)
+
             except Exception as e:
                 print(f"Error en el proceso: {e}")
-                
+
             time.sleep(3)
 
 
@@ -125,7 +553,6 @@ if __name__ == "__main__":
         'host': '127.0.0.1',
         'port': 5432
     }
-    
+
     calculator = PositionCalculator(db_config)
     calculator.run()
-
@@ -0,0 +1,124 @@
+import json
+import psycopg2
+import paho.mqtt.client as mqtt
+from contextlib import contextmanager
+
+MQTT_HOST = 'localhost'
+MQTT_PORT = 1884
+MQTT_TOPIC_CALIB = 'calibration'
+MQTT_TOPIC_OFFSET = 'calibration/{mac}'
+
+# no se reenvía un offset si el residuo medido es menor que este umbral
+UMBRAL_RESIDUO_CM = 1.0
+# aviso de deriva si el offset se aleja más de esto de la primera calibración
+UMBRAL_DERIVA_CM = 20
+
+
+class AnchorCalibrator:
+    """calcula el offset FTM de cada anchor a partir de las medidas de un tag
+    situado a una distancia de referencia conocida y lo envía al anchor"""
+
+    def __init__(self, db_config):
+        self.db_config = db_config
+        self.client = mqtt.Client(mqtt.CallbackAPIVersion.VERSION2)
+        self.client.on_connect = self.on_connect
+        self.client.on_message = self.on_message
+
+    @contextmanager
+    def get_db_connection(self):
+        conn = psycopg2.connect(**self.db_config)
+        try:
+            yield conn
+        finally:
+            conn.close()
+
+    def get_device_id(self, cursor, mac, id_type):
+        """se obtiene el id del dispositivo, creándolo si no existe"""
+        cursor.execute("""
+            INSERT INTO devices (mac, id_type) VALUES (%s, %s)
+            ON CONFLICT (mac) DO UPDATE SET mac = EXCLUDED.mac
+            RETURNING id
+        """, (mac, id_type))
+        return cursor.fetchone()[0]
+
+    def get_current_offset(self, cursor, anchor_id):
+        """offset aplicado actualmente por el anchor (última calibración o el que anuncia)"""
+        cursor.execute("""
+            SELECT offset_cm FROM anchor_calibration
+            WHERE id_anchor = %s ORDER BY created_at DESC, id DESC LIMIT 1
+        """, (anchor_id,))
+        row = cursor.fetchone()
+        if row:
+            return row[0]
+
+        cursor.execute('SELECT ftm_offset_cm FROM devices WHERE id = %s', (anchor_id,))
+        row = cursor.fetchone()
+        return row[0] if row and row[0] is not None else 0
+
+    def calibrate(self, cursor, data):
+        """la medida ya incluye el offset actual, así que el residuo se suma a él"""
+        anchor_id = self.get_device_id(cursor, data['mac_dst'], 1)
+        tag_id = self.get_device_id(cursor, data['mac_src'], 2)
+
+        measured = float(data['distance_cm'])
+        reference = float(data['reference_cm'])
+        residual = measured - reference
+        current = self.get_current_offset(cursor, anchor_id)
+        changed = abs(residual) >= UMBRAL_RESIDUO_CM
+        offset = int(round(current + residual)) if changed else current
+
+        cursor.execute("""
+            INSERT INTO anchor_calibration (id_anchor, id_tag, reference_cm, measured_cm, offset_cm)
+            VALUES (%s, %s, %s, %s, %s)
+        """, (anchor_id, tag_id, reference, measured, offset))
+
+        cursor.execute("""
+            SELECT drift_cm FROM anchor_calibration_drift
+            WHERE id_anchor = %s ORDER BY created_at DESC, id DESC LIMIT 1
+        """, (anchor_id,))
+        drift = cursor.fetchone()[0]
+        if abs(drift) > UMBRAL_DERIVA_CM:
+            print(f"Aviso: el anchor {data['mac_dst']} ha derivado {drift} cm desde su primera calibración")
+
+        print(f"Anchor {data['mac_dst']}: medido {measured:.1f} cm, referencia {reference:.1f} cm, offset {current} -> {offset} cm")
+        return offset if changed else None
+
+    def on_connect(self, client, userdata, flags, reason_code, properties):
+        client.subscribe(MQTT_TOPIC_CALIB, qos=1)
+
+    def on_message(self, client, userdata, msg):
+        try:
+            payload = json.loads(msg.payload)
+            with self.get_db_connection() as conn:
+                with conn.cursor() as cursor:
+                    offsets = {}
+                    for data in payload:
+                        offset = self.calibrate(cursor, data)
+                        if offset is not None:
+                            offsets[data['mac_dst']] = offset
+                    conn.commit()
+
+            # retenido para que el anchor lo reciba aunque se conecte más tarde
+            for mac, offset in offsets.items():
+                client.publish(MQTT_TOPIC_OFFSET.format(mac=mac),
+                               json.dumps({'offset_cm': offset}), qos=1, retain=True)
+
+        except Exception as e:
+            print(f"Error en la calibración: {e}")
+
+    def run(self):
+        self.client.connect(MQTT_HOST, MQTT_PORT)
+        self.client.loop_forever()
+
+
+if __name__ == "__main__":
+    db_config = {
+        'dbname': 'postgres2',
+        'user': 'postgres',
+        'password': 'lucia',
+        'host': '127.0.0.1',
+        'port': 5432
+    }
+
+    calibrator = AnchorCalibrator(db_config)
+    calibrator.run()
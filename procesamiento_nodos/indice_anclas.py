@@ -0,0 +1,88 @@
+import math
+from collections import Counter, defaultdict
+import numpy as np
+
+# índice espacial de los anchors para despliegues grandes: rejilla uniforme de celdas
+# de CELDA_M metros por área (zona, planta) de devices. Una zona es un área independiente
+# (edificio, nave) y una planta un nivel de ella: los anchors de áreas distintas nunca
+# se combinan en una misma posición
+
+CELDA_M = 10.0
+# alcance FTM en interiores: un anchor más lejos de la última posición del tag es de
+# otra parte del edificio (o está mal configurado) y no se usa
+RADIO_ANCLAS_M = 40.0
+# anchors con los que se resuelve cada tag, los más cercanos
+CANDIDATAS_MAX = 12
+MIN_CANDIDATAS = 3
+
+# en modo 3D la planta de cada posición sale de su altura: cota (m) del suelo de cada
+# planta, de abajo arriba, empezando por PRIMERA_PLANTA (-1 si hay sótano)
+COTAS_PLANTAS_M = (0.0, 3.5, 7.0, 10.5, 14.0)
+PRIMERA_PLANTA = 0
+
+
+def planta_por_altura(z, cotas=COTAS_PLANTAS_M):
+    """planta de cada altura z (m) por bandas entre cotas consecutivas; por debajo de
+    la primera cota, la primera planta, y por encima de la última, la última. NaN
+    donde z no es finita"""
+    z = np.asarray(z, dtype=float)
+    banda = np.clip(np.searchsorted(cotas, z, side='right') - 1, 0, len(cotas) - 1)
+    return np.where(np.isfinite(z), banda + PRIMERA_PLANTA, np.nan)
+
+
+class IndiceAnclas:
+    """posiciones {id: (x, y)}; zonas y plantas {id: valor} (None si no se ha
+    asignado). Se rehace solo cuando cambian los anchors"""
+
+    def __init__(self, posiciones, zonas=None, plantas=None):
+        self.posiciones = posiciones
+        self.zonas = zonas or {}
+        self.plantas = plantas or {}
+        self.celdas = defaultdict(list)
+        for anchor_id, (x, y) in posiciones.items():
+            self.celdas[(self.area(anchor_id),) + self._celda(x, y)].append(anchor_id)
+
+    def __len__(self):
+        return len(self.posiciones)
+
+    @staticmethod
+    def _celda(x, y):
+        return math.floor(x / CELDA_M), math.floor(y / CELDA_M)
+
+    def area(self, anchor_id):
+        return self.zonas.get(anchor_id), self.plantas.get(anchor_id)
+
+    def cercanos(self, posicion, radio, area):
+        """anchors del área a menos de radio (m) de la posición, mirando solo las celdas
+        que cubre el círculo"""
+        x, y = posicion
+        cx, cy = self._celda(x, y)
+        n = math.ceil(radio / CELDA_M)
+        encontrados = []
+        for i in range(cx - n, cx + n + 1):
+            for j in range(cy - n, cy + n + 1):
+                for anchor_id in self.celdas.get((area, i, j), ()):
+                    ax, ay = self.posiciones[anchor_id]
+                    if (ax - x)**2 + (ay - y)**2 <= radio**2:
+                        encontrados.append(anchor_id)
+        return encontrados
+
+    def candidatos(self, reportados, posicion=None):
+        """anchors con los que resolver un tag, ordenados por id. reportados {anchor:
+        distancia (m)} son los que ha medido en la ventana: se queda el área de la que
+        más ha medido y, si se conoce su última posición, los que están a menos de
+        RADIO_ANCLAS_M (mientras queden MIN_CANDIDATAS); como mucho CANDIDATAS_MAX, los
+        de menor distancia medida"""
+        reportados = {a: d for a, d in reportados.items() if a in self.posiciones}
+        if not reportados:
+            return ()
+        area = Counter(self.area(a) for a in reportados).most_common(1)[0][0]
+        elegidos = {a: d for a, d in reportados.items() if self.area(a) == area}
+
+        if posicion is not None and all(math.isfinite(c) for c in posicion):
+            cerca = set(self.cercanos(posicion, RADIO_ANCLAS_M, area))
+            dentro = {a: d for a, d in elegidos.items() if a in cerca}
+            if len(dentro) >= MIN_CANDIDATAS:
+                elegidos = dentro
+
+        return tuple(sorted(sorted(elegidos, key=lambda a: (elegidos[a], a))[:CANDIDATAS_MAX]))
@@ -0,0 +1,175 @@
+import ctypes
+import os
+import numpy as np
+from resolver_trilateracion import GeometriaAnclas, Solucion
+
+# enlace con libftm_multilat (ESP32/components/ftm_multilat, compilada con ingesta/CMakeLists.txt).
+# Se busca en FTM_MULTILAT_LIB o en ingesta/build; si no está, el import falla con ImportError
+# y calcular_localizacion usa resolver_trilateracion
+RUTAS = [
+    os.environ.get('FTM_MULTILAT_LIB'),
+    os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'ingesta', 'build', 'libftm_multilat.so'),
+    'libftm_multilat.so',
+]
+
+# mismo orden y alineación que ftm_fix_t en ftm_multilat.h
+FIX_DTYPE = np.dtype([
+    ('x', 'f8'), ('y', 'f8'),
+    ('cov_xx', 'f8'), ('cov_xy', 'f8'), ('cov_yy', 'f8'),
+    ('rms', 'f8'),
+    ('rejected', 'u8'),
+    ('n_anchors', 'i4'), ('iterations', 'i4'), ('status', 'i4'),
+], align=True)
+
+FTM_MULTILAT_OK = 0
+
+
+def _cargar():
+    for ruta in RUTAS:
+        if not ruta:
+            continue
+        try:
+            return ctypes.CDLL(ruta)
+        except OSError:
+            continue
+    raise ImportError('no se encuentra libftm_multilat.so (compilar ingesta/ o definir FTM_MULTILAT_LIB)')
+
+
+_lib = _cargar()
+_doubles = np.ctypeslib.ndpointer(dtype=np.float64, flags='C_CONTIGUOUS')
+_lib.ftm_multilat_solve_batch.restype = ctypes.c_size_t
+_lib.ftm_multilat_solve_batch.argtypes = [
+    _doubles, ctypes.c_size_t, _doubles, _doubles, ctypes.c_size_t, _doubles,
+    np.ctypeslib.ndpointer(dtype=FIX_DTYPE, flags='C_CONTIGUOUS'),
+]
+_lib.ftm_multilat_solve_batch_indexed.restype = ctypes.c_size_t
+_lib.ftm_multilat_solve_batch_indexed.argtypes = [
+    _doubles, ctypes.c_size_t, np.ctypeslib.ndpointer(dtype=np.int32, flags='C_CONTIGUOUS'), ctypes.c_size_t,
+    _doubles, _doubles, ctypes.c_size_t, _doubles,
+    np.ctypeslib.ndpointer(dtype=FIX_DTYPE, flags='C_CONTIGUOUS'),
+]
+# los anchors se marcan como rechazados en una máscara de 64 bits
+MAX_ANCLAS = 64
+
+
+def resolver_multilateracion(anclas, distancias, varianzas, indices=None):
+    """misma interfaz y resultado (Solucion) que resolver_trilateracion.resolver_multilateracion,
+    resuelto en C++ con todos los tags en una llamada, repartidos entre hilos si son muchos.
+    De GeometriaAnclas solo se usan las posiciones: en C++ el paso lineal ya es barato."""
+    if isinstance(anclas, GeometriaAnclas):
+        anclas = anclas.anclas
+    anclas = np.ascontiguousarray(anclas, dtype=np.float64)
+    distancias = np.ascontiguousarray(np.atleast_2d(distancias), dtype=np.float64)
+    varianzas = np.ascontiguousarray(np.atleast_2d(varianzas), dtype=np.float64)
+    n_tags, n_anclas = distancias.shape
+
+    fixes = np.zeros(n_tags, dtype=FIX_DTYPE)
+    residuos = np.empty((n_tags, n_anclas))
+    if indices is None:
+        _lib.ftm_multilat_solve_batch(anclas, n_anclas, distancias, varianzas, n_tags, residuos, fixes)
+    else:
+        indices = np.ascontiguousarray(np.atleast_2d(indices), dtype=np.int32)
+        _lib.ftm_multilat_solve_batch_indexed(anclas, len(anclas), indices, n_anclas, distancias, varianzas,
+                                              n_tags, residuos, fixes)
+
+    ok = fixes['status'] == FTM_MULTILAT_OK
+    posiciones = np.where(ok[:, None], np.column_stack([fixes['x'], fixes['y']]), np.nan)
+    covarianzas = np.full((n_tags, 2, 2), np.nan)
+    covarianzas[ok, 0, 0] = fixes['cov_xx'][ok]
+    covarianzas[ok, 0, 1] = covarianzas[ok, 1, 0] = fixes['cov_xy'][ok]
+    covarianzas[ok, 1, 1] = fixes['cov_yy'][ok]
+    bits = np.arange(min(n_anclas, MAX_ANCLAS), dtype=np.uint64)
+    rechazados = np.zeros((n_tags, n_anclas), dtype=bool)
+    rechazados[:, :len(bits)] = (fixes['rejected'][:, None] >> bits) & np.uint64(1) == 1
+    return Solucion(posiciones, covarianzas, fixes['n_anchors'], residuos, rechazados)
+
+
+# filtro de partículas con plano de planta (ftm_particles.h)
+class _Estimacion(ctypes.Structure):
+    _fields_ = [(nombre, ctypes.c_double) for nombre in
+                ('x', 'y', 'vx', 'vy', 'cov_xx', 'cov_xy', 'cov_yy', 'rms', 'ess')] + \
+               [('n_ranges', ctypes.c_int32), ('resampled', ctypes.c_int32)]
+
+
+_lib.ftm_floor_plan_create.restype = ctypes.c_void_p
+_lib.ftm_floor_plan_create.argtypes = [
+    np.ctypeslib.ndpointer(dtype=np.uint8, flags='C_CONTIGUOUS'), ctypes.c_size_t, ctypes.c_size_t,
+    ctypes.c_double, ctypes.c_double, ctypes.c_double,
+]
+_lib.ftm_floor_plan_destroy.argtypes = [ctypes.c_void_p]
+_lib.ftm_pf_create.restype = ctypes.c_void_p
+_lib.ftm_pf_create.argtypes = [ctypes.c_size_t, ctypes.c_void_p, ctypes.c_double, ctypes.c_uint32]
+_lib.ftm_pf_destroy.argtypes = [ctypes.c_void_p]
+_lib.ftm_pf_reset.argtypes = [ctypes.c_void_p, ctypes.c_double, ctypes.c_double, ctypes.c_double]
+_lib.ftm_pf_step.argtypes = [
+    ctypes.c_void_p, ctypes.c_double, _doubles, _doubles, _doubles, ctypes.c_size_t, ctypes.POINTER(_Estimacion),
+]
+
+
+def cargar_pgm(ruta):
+    """imagen PGM binaria (P5, 8 bits) como array de filas de arriba abajo"""
+    with open(ruta, 'rb') as f:
+        datos = f.read()
+    campos = []
+    pos = 0
+    while len(campos) < 4:
+        while datos[pos:pos + 1].isspace():
+            pos += 1
+        if datos[pos:pos + 1] == b'#':
+            pos = datos.index(b'\n', pos)
+            continue
+        fin = pos
+        while not datos[fin:fin + 1].isspace():
+            fin += 1
+        campos.append(datos[pos:fin])
+        pos = fin
+    if campos[0] != b'P5' or int(campos[3]) > 255:
+        raise ValueError(f'{ruta}: solo se admite PGM binario de 8 bits')
+    ancho, alto = int(campos[1]), int(campos[2])
+    return np.frombuffer(datos, dtype=np.uint8, count=ancho * alto, offset=pos + 1).reshape(alto, ancho)
+
+
+class PlanoPlanta:
+    """rejilla de ocupación (True en las paredes) con su campo de distancias en C++.
+    La fila 0 de `ocupado` es la de arriba, como en la imagen del plano; origen es la
+    esquina inferior izquierda en metros"""
+
+    def __init__(self, ocupado, resolucion_m, origen=(0.0, 0.0)):
+        rejilla = np.ascontiguousarray(np.flipud(np.asarray(ocupado, dtype=bool)), dtype=np.uint8)
+        self.alto, self.ancho = rejilla.shape
+        self._plano = _lib.ftm_floor_plan_create(rejilla, self.ancho, self.alto, resolucion_m, *origen)
+
+    @classmethod
+    def desde_pgm(cls, ruta, resolucion_m, origen=(0.0, 0.0), umbral=128):
+        """las paredes son los píxeles más oscuros que `umbral`"""
+        return cls(cargar_pgm(ruta) < umbral, resolucion_m, origen)
+
+    def __del__(self):
+        if getattr(self, '_plano', None):
+            _lib.ftm_floor_plan_destroy(self._plano)
+
+
+class FiltroParticulas:
+    """filtro de partículas de un tag; guarda una referencia al plano para que no se
+    libere antes que el filtro"""
+
+    def __init__(self, n_particulas, plano=None, ruido_proceso=0.5, semilla=1):
+        self.plano = plano
+        self._pf = _lib.ftm_pf_create(n_particulas, plano._plano if plano else None, ruido_proceso, semilla)
+
+    def __del__(self):
+        if getattr(self, '_pf', None):
+            _lib.ftm_pf_destroy(self._pf)
+
+    def reiniciar(self, x, y, sigma):
+        _lib.ftm_pf_reset(self._pf, x, y, sigma)
+
+    def paso(self, dt, anclas, distancias, varianzas):
+        """predice dt segundos, pondera con las distancias (una por fila de anclas) y
+        devuelve la estimación"""
+        anclas = np.ascontiguousarray(anclas, dtype=np.float64).reshape(-1, 2)
+        distancias = np.ascontiguousarray(distancias, dtype=np.float64)
+        varianzas = np.ascontiguousarray(varianzas, dtype=np.float64)
+        estimacion = _Estimacion()
+        _lib.ftm_pf_step(self._pf, dt, anclas, distancias, varianzas, len(distancias), ctypes.byref(estimacion))
+        return estimacion
@@ -0,0 +1,200 @@
+import sys
+import json
+import itertools
+import psycopg2
+import paho.mqtt.publish as publish
+from collections import defaultdict
+from contextlib import contextmanager
+
+MQTT_HOST = 'localhost'
+MQTT_PORT = 1884
+MQTT_TOPIC_CONFIG = 'config/{mac}'
+
+# canal del AP de infraestructura: en modo APSTA el SoftAP de los anchors lo sigue
+# mientras la interfaz STA está asociada, así que un anchor que publica por Wi-Fi
+# no puede salir de este canal aunque se le configure otro
+CANAL_UPLINK = 6
+CANALES_LIBRES = [1, 6, 11]
+
+# medidas recientes de data_tag usadas para saber qué anchors ve cada tag
+VENTANA_FILAS = 5000
+
+# modelo de tiempos de la ronda del tag (ver ftm_session_task)
+SESIONES_POR_RONDA = 8
+T_SESION_MS = 60            # duración de una sesión FTM sin competencia
+T_ESPERA_SESION_MS = 1000   # espera entre sesiones del tag
+T_AIRE_SESION_MS = 5        # tiempo de aire de una ráfaga de 16 tramas FTM
+T_CAMBIO_CANAL_MS = 15
+T_RONDA_MS = 30000          # periodo aproximado entre rondas de un tag
+OCUPACION_MAX = 0.5         # fracción de tiempo de aire disponible para FTM por canal
+
+
+class ChannelPlanner:
+    """asigna canales a los anchors para que cada tag mida en el menor número
+    de canales posible, alineados con el canal del AP de infraestructura"""
+
+    def __init__(self, db_config):
+        self.db_config = db_config
+
+    @contextmanager
+    def get_db_connection(self):
+        conn = psycopg2.connect(**self.db_config)
+        try:
+            yield conn
+        finally:
+            conn.close()
+
+    def get_visibility(self, cursor):
+        """anchors de cada tag según las medidas recientes"""
+        cursor.execute('SELECT id, upper(mac::text), channel FROM devices WHERE id_type = 1')
+        anchors = {row[0]: {'mac': row[1], 'channel': row[2]} for row in cursor.fetchall()}
+
+        cursor.execute("""
+            SELECT DISTINCT id_src, id_dst FROM (
+                SELECT id_src, id_dst FROM data_tag ORDER BY id DESC LIMIT %s
+            ) recientes
+        """, (VENTANA_FILAS,))
+
+        visible = defaultdict(set)
+        for tag_id, anchor_id in cursor.fetchall():
+            if anchor_id in anchors:
+                visible[tag_id].add(anchor_id)
+
+        return anchors, visible
+
+    def channel_load(self, plan, visible):
+        """ocupación del canal: sesiones FTM de todos los tags por periodo de ronda"""
+        load = defaultdict(float)
+        for anchors in visible.values():
+            for anchor_id in anchors:
+                load[plan[anchor_id]] += SESIONES_POR_RONDA * T_AIRE_SESION_MS / T_RONDA_MS
+        return load
+
+    def compute_plan(self, anchors, visible, movable):
+        """agrupa en el canal del uplink mientras haya tiempo de aire; el resto de
+        anchors va al canal libre donde ya están más anchors co-visibles. Solo los
+        anchors de movable (sin STA asociada) pueden salir de CANAL_UPLINK"""
+        covisible = defaultdict(set)
+        for tag_anchors in visible.values():
+            for a, b in itertools.permutations(tag_anchors, 2):
+                covisible[a].add(b)
+
+        # primero los anchors más vistos, que son los que más tiempo de aire consumen
+        seen_by = defaultdict(int)
+        for tag_anchors in visible.values():
+            for anchor_id in tag_anchors:
+                seen_by[anchor_id] += 1
+        order = sorted(anchors, key=lambda a: (-seen_by[a], a))
+
+        plan = {}
+        load = defaultdict(float)
+        for anchor_id in order:
+            cost = seen_by[anchor_id] * SESIONES_POR_RONDA * T_AIRE_SESION_MS / T_RONDA_MS
+            if anchor_id not in movable:
+                plan[anchor_id] = CANAL_UPLINK
+                load[CANAL_UPLINK] += cost
+                continue
+            candidates = [CANAL_UPLINK] + sorted(
+                (c for c in CANALES_LIBRES if c != CANAL_UPLINK),
+                key=lambda c: (-sum(1 for n in covisible[anchor_id] if plan.get(n) == c), load[c]))
+
+            channel = next((c for c in candidates if load[c] + cost <= OCUPACION_MAX),
+                           min(candidates, key=lambda c: load[c]))
+            plan[anchor_id] = channel
+            load[channel] += cost
+
+        return plan
+
+    def simulate(self, plan, visible):
+        """tiempo esperado de ronda por tag: sesiones alargadas por la ocupación del
+        canal (1 / (1 - ρ)), esperas entre sesiones y cambios de canal, incluido el
+        del uplink"""
+        load = self.channel_load(plan, visible)
+        times = {}
+        for tag_id, tag_anchors in visible.items():
+            total = 0.0
+            for anchor_id in tag_anchors:
+                rho = min(load[plan[anchor_id]], 0.95)
+                total += SESIONES_POR_RONDA * (T_ESPERA_SESION_MS + T_SESION_MS / (1.0 - rho))
+            channels = {plan[a] for a in tag_anchors}
+            switches = len(channels) - 1 + (0 if CANAL_UPLINK in channels else 1)
+            total += switches * T_CAMBIO_CANAL_MS
+            times[tag_id] = (total, len(channels))
+        return times, load
+
+    def report(self, plans, visible):
+        for name, plan in plans.items():
+            times, load = self.simulate(plan, visible)
+            print(f"\nPlan '{name}':")
+            print("  ocupación por canal: " + ", ".join(
+                f"{c}: {load[c] * 100:.1f}%" for c in sorted(load)))
+            for tag_id, (t, n) in sorted(times.items()):
+                print(f"  tag {tag_id}: {n} canales, ronda esperada {t / 1000:.2f} s")
+            if times:
+                mean = sum(t for t, _ in times.values()) / len(times)
+                print(f"  media: {mean / 1000:.2f} s")
+
+    def push(self, anchors, plan, movable):
+        """publica el canal en el topic de configuración de cada anchor (retenido)"""
+        msgs = [{
+            'topic': MQTT_TOPIC_CONFIG.format(mac=anchors[a]['mac']),
+            'payload': json.dumps({'channel': c}),
+            'qos': 1,
+            'retain': True,
+        } for a, c in plan.items() if a in movable and anchors[a]['channel'] != c]
+
+        if msgs:
+            publish.multiple(msgs, hostname=MQTT_HOST, port=MQTT_PORT)
+        print(f"Plan enviado a {len(msgs)} anchors")
+
+    def run(self, apply_plan, free_macs):
+        with self.get_db_connection() as conn:
+            with conn.cursor() as cursor:
+                anchors, visible = self.get_visibility(cursor)
+
+        if not anchors:
+            print("No hay anchors registrados")
+            return
+
+        # devices.channel es el canal que la radio anuncia, no el configurado
+        current = {a: info['channel'] or CANAL_UPLINK for a, info in anchors.items()}
+        movable = {a for a, info in anchors.items() if info['mac'] in free_macs}
+        for anchor_id, channel in sorted(current.items()):
+            if anchor_id not in movable and channel != CANAL_UPLINK:
+                print(f"Aviso: anchor {anchor_id} ({anchors[anchor_id]['mac']}) en el canal {channel}, "
+                      f"distinto de CANAL_UPLINK ({CANAL_UPLINK})")
+        planned = self.compute_plan(anchors, visible, movable)
+
+        self.report({
+            'actual': current,
+            'uplink': {a: CANAL_UPLINK for a in anchors},
+            'calculado': planned,
+        }, visible)
+
+        print("\nAsignación calculada:")
+        for anchor_id, channel in sorted(planned.items()):
+            fixed = '' if anchor_id in movable else ' (fijo: STA asociada)'
+            print(f"  anchor {anchor_id} ({anchors[anchor_id]['mac']}): canal {current[anchor_id]} -> {channel}{fixed}")
+
+        if apply_plan:
+            self.push(anchors, planned, movable)
+
+
+if __name__ == "__main__":
+    db_config = {
+        'dbname': 'postgres2',
+        'user': 'postgres',
+        'password': 'lucia',
+        'host': '127.0.0.1',
+        'port': 5432
+    }
+
+    # --libres=MAC,MAC: anchors sin STA asociada (p. ej. con uplink cableado),
+    # los únicos a los que se puede mover de canal
+    free_macs = set()
+    for arg in sys.argv[1:]:
+        if arg.startswith('--libres='):
+            free_macs.update(m.strip().upper() for m in arg.split('=', 1)[1].split(',') if m.strip())
+
+    planner = ChannelPlanner(db_config)
+    planner.run('--aplicar' in sys.argv[1:], free_macs)
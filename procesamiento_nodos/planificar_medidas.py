@@ -0,0 +1,128 @@
+import json
+import itertools
+import numpy as np
+import paho.mqtt.publish as publish
+from indice_anclas import CANDIDATAS_MAX
+
+# planes de medida: desde la última posición de cada tag se calcula con la geometría
+# de los anchors (GDOP) la precisión que dan los anchors que ve, y se eligen de forma
+# voraz los pocos que cumplen PRECISION_OBJETIVO_M. El plan se publica retenido en
+# MQTT_TOPIC_PLAN; los gateways se lo devuelven al tag tras cada ronda y el tag solo
+# mide esos anchors (ver plan_order en el firmware del tag)
+
+MQTT_HOST = 'localhost'
+MQTT_PORT = 1884
+MQTT_TOPIC_PLAN = 'plan/{mac}'
+
+# raíz de la traza de la covarianza esperada de la posición (m)
+PRECISION_OBJETIVO_M = 0.3
+# con uno de reserva sobre los tres necesarios se puede seguir descartando un anchor NLOS
+ANCLAS_MIN_PLAN = 4
+# FTM_UPLINK_PLAN_MAX en ftm_uplink.h
+ANCLAS_MAX_PLAN = 12
+# desviación (m) de las distancias de un par sin muestras suficientes, y mínima
+SIGMA_DEFECTO_M = 0.3
+SIGMA_MIN_M = 0.1
+# tras un fallo del broker no se vuelve a publicar hasta pasado este tiempo (s)
+REINTENTO_PUBLICACION_S = 60
+
+
+def informacion(posicion, anclas, sigmas):
+    """matriz de información (n,2,2) de la distancia a cada anchor en la posición dada:
+    u·uᵀ/σ², con u el vector unitario del anchor al tag"""
+    u = np.asarray(posicion, dtype=float) - np.asarray(anclas, dtype=float)
+    r = np.linalg.norm(u, axis=1)
+    u = np.where(r[:, None] > 0, u / np.where(r > 0, r, 1.0)[:, None], 0.0)
+    return u[:, :, None] * u[:, None, :] / (np.asarray(sigmas, dtype=float)**2)[:, None, None]
+
+
+def error_esperado(J):
+    """raíz de la traza de J⁻¹ para matrices de información (..., 2, 2), que con σ
+    iguales es GDOP·σ; inf si la geometría es degenerada"""
+    det = J[..., 0, 0] * J[..., 1, 1] - J[..., 0, 1] * J[..., 1, 0]
+    traza = J[..., 0, 0] + J[..., 1, 1]
+    with np.errstate(divide='ignore', invalid='ignore'):
+        return np.where(det > 1e-12 * traza**2, np.sqrt(traza / det), np.inf)
+
+
+def seleccionar_anclas(posicion, anclas, sigmas, objetivo=PRECISION_OBJETIVO_M, minimo=ANCLAS_MIN_PLAN):
+    """índices de un subconjunto pequeño de anchors cuyo error esperado no supera el
+    objetivo, y su error. De los CANDIDATAS_MAX anchors más cercanos se parte del mejor
+    par y se añade cada vez el que más reduce el error (selección voraz sobre la matriz
+    de información), hasta llegar a minimo anchors con el objetivo cumplido o a
+    ANCLAS_MAX_PLAN. El coste crece con n·k en vez de con las combinaciones de n"""
+    posicion = np.asarray(posicion, dtype=float)
+    anclas = np.asarray(anclas, dtype=float)
+    candidatas = np.argsort(np.linalg.norm(anclas - posicion, axis=1), kind='stable')[:CANDIDATAS_MAX]
+    info = informacion(posicion, anclas[candidatas], np.asarray(sigmas, dtype=float)[candidatas])
+    n = len(info)
+
+    # un anchor solo no fija la posición: el punto de partida es el mejor par
+    pares = np.array(list(itertools.combinations(range(n), 2)))
+    errores = error_esperado(info[pares[:, 0]] + info[pares[:, 1]])
+    elegidos = list(pares[np.argmin(errores)])
+    J = info[elegidos].sum(axis=0)
+    error = float(errores.min())
+
+    while len(elegidos) < min(n, ANCLAS_MAX_PLAN) and (len(elegidos) < minimo or error > objetivo):
+        libres = np.setdiff1d(np.arange(n), elegidos)
+        errores = error_esperado(J + info[libres])
+        mejor = int(np.argmin(errores))
+        elegidos.append(int(libres[mejor]))
+        J = J + info[libres[mejor]]
+        error = float(errores[mejor])
+    return np.sort(candidatas[elegidos]), error
+
+
+class RangingPlanner:
+    """planes de medida de los tags; solo se publica el de un tag cuando cambia"""
+
+    def __init__(self):
+        self.plans = {}
+        self.retry_at = 0.0
+
+    def update(self, tag_ids, posiciones, anclas, visibles, macs, ahora):
+        """tag_ids y sus posiciones (k,2); anclas {id: (x, y)}; visibles {tag: {anchor:
+        σ en m}} con los anchors que ha medido cada tag; macs {id: MAC}. Devuelve los
+        planes nuevos {tag: (anchors, error esperado)}"""
+        if ahora < self.retry_at:
+            return {}
+
+        nuevos = {}
+        for tag_id, posicion in zip(tag_ids, posiciones):
+            vistos = sorted(a for a in visibles.get(tag_id, {}) if a in anclas)
+            if tag_id not in macs or len(vistos) < 3 or not np.all(np.isfinite(posicion)):
+                continue
+            pos = np.array([anclas[a] for a in vistos], dtype=float)
+            sigmas = np.maximum([visibles[tag_id][a] for a in vistos], SIGMA_MIN_M)
+            idx, error = seleccionar_anclas(posicion, pos, sigmas)
+
+            # el plan actual se mantiene mientras cumpla el objetivo y no sobren anchors,
+            # para no cambiarlo con cada pequeño movimiento del tag
+            actual = self.plans.get(tag_id)
+            if actual is not None and set(actual) <= set(vistos) and len(actual) <= len(idx):
+                k = [vistos.index(a) for a in actual]
+                if error_esperado(informacion(posicion, pos[k], sigmas[k]).sum(axis=0)) <= PRECISION_OBJETIVO_M:
+                    continue
+            plan = tuple(vistos[i] for i in idx)
+            if plan != actual:
+                nuevos[tag_id] = (plan, error)
+
+        if not nuevos:
+            return {}
+        msgs = [{
+            'topic': MQTT_TOPIC_PLAN.format(mac=macs[tag_id]),
+            'payload': json.dumps({'anchors': [macs[a] for a in plan], 'error_m': round(error, 3)}),
+            'qos': 1,
+            'retain': True,
+        } for tag_id, (plan, error) in nuevos.items()]
+        try:
+            publish.multiple(msgs, hostname=MQTT_HOST, port=MQTT_PORT)
+        except OSError as e:
+            print(f"No se pudieron publicar los planes de medida: {e}")
+            self.retry_at = ahora + REINTENTO_PUBLICACION_S
+            return {}
+
+        for tag_id, (plan, _) in nuevos.items():
+            self.plans[tag_id] = plan
+        return nuevos
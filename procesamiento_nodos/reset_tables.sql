@@ -1,6 +1,18 @@
 DELETE FROM data_tag;
 SELECT setval('public.data_tag_id_seq', 1, false); 
 
+DELETE FROM pair_stats;
+
+DELETE FROM tag_positions;
+SELECT setval('public.tag_positions_id_seq', 1, false); 
+
+DELETE FROM tag_tracks;
+
+DELETE FROM tag_rounds;
+
+DELETE FROM anchor_calibration;
+SELECT setval('public.anchor_calibration_id_seq', 1, false); 
+
 DELETE FROM devices;
 SELECT setval('public.devices_id_seq', 1, false); 
 
@@ -1,22 +1,357 @@
+import itertools
+from collections import namedtuple
+
 import numpy as np
 
-def resolver_trilateracion(nodos_x, nodos_y, distancias):
-    x1, x2, x3 = nodos_x[:3]
-    y1, y2, y3 = nodos_y[:3]
-    d1, d2, d3 = distancias[:3]
+# anchors mínimos con distancia válida para resolver un tag en 2D (en 3D, uno más)
+MIN_ANCLAS = 3
+# varianza (m²) de la distancia media de un par con una sola medida, y mínima
+# admitida, para que un par casi sin ruido no se lleve todo el peso
+VARIANZA_DEFECTO_M2 = 0.09
+VARIANZA_MIN_M2 = 1e-4
+# número de condición máximo de los sistemas (anchors casi alineados)
+CONDICION_MAX = 1e10
+# iteraciones de Levenberg-Marquardt y paso (m) con el que se dan por terminadas
+ITERACIONES_MAX = 10
+TOLERANCIA_M = 1e-4
+
+# pérdida robusta del refinado: 'cuadratica', 'huber' o 'tukey'. Los residuos se
+# tipifican con la desviación de cada distancia, nunca menor que SIGMA_MIN_ROBUSTA_M
+# para que una ventana muy estable no convierta en atípicos errores pequeños del
+# modelo (posición de los anchors, calibración)
+PERDIDA = 'huber'
+SIGMA_MIN_ROBUSTA_M = 0.15
+HUBER_K = 1.345
+TUKEY_C = 4.685
+# residuo tipificado a partir del cual se rechaza un anchor
+Z_RECHAZO = 3.0
+# RANSAC sobre tríos de anchors (cuartetos en 3D) si quedan atípicos y hay al menos
+# RANSAC_MIN_ANCLAS (uno más en 3D)
+RANSAC_MIN_ANCLAS = 5
+RANSAC_MAX_SUBCONJUNTOS = 220
+# pseudoinversas guardadas como mucho; con miles de tags cada uno con sus anchors
+# cercanos van apareciendo subconjuntos nuevos según se mueven
+PSEUDOINVERSAS_MAX = 65536
+
+# mismos valores y significado que ftm_multilat.hpp, para que los dos resolvedores
+# den las mismas posiciones
+Solucion = namedtuple('Solucion', ['posiciones', 'covarianzas', 'n_anclas', 'residuos', 'rechazados'])
+
+
+def _condicion(M, M_inv):
+    """número de condición en norma de Frobenius de una pila de matrices"""
+    with np.errstate(invalid='ignore'):
+        return np.linalg.norm(M, axis=(-2, -1)) * np.linalg.norm(M_inv, axis=(-2, -1))
+
+
+class GeometriaAnclas:
+    """lo que solo depende de las posiciones de los anchors: el centrado, la escala y,
+    para cada subconjunto de anchors con distancia válida, la pseudoinversa del sistema
+    lineal (PSEUDOINVERSAS_MAX como mucho; al llenarse se empieza de nuevo). Se
+    conserva entre ciclos y se rehace solo cuando cambian las posiciones
+    (PositionCalculator.get_devices). Con anchors (N, 3) el sistema es en 3D"""
+
+    def __init__(self, anclas):
+        anclas = np.asarray(anclas, dtype=float)
+        self.dimension = anclas.shape[1] if anclas.ndim == 2 and anclas.shape[1] == 3 else 2
+        self.anclas = anclas.reshape(-1, self.dimension)
+        self.minimo = MIN_ANCLAS + self.dimension - 2
+        self.centro = self.anclas.mean(axis=0) if len(self.anclas) else np.zeros(self.dimension)
+        # se trabaja en unidades de la dispersión de los anchors para que las columnas
+        # x, y (z) y R del sistema lineal tengan magnitudes parecidas
+        u = self.anclas - self.centro
+        self.escala = np.sqrt((u**2).sum(axis=1).mean()) if len(u) else 0.0
+        if not self.escala > 0:
+            self.escala = 1.0
+        self.u = u / self.escala
+        self.A = np.column_stack([2 * self.u, -np.ones(len(self.u))])
+        self.norma2 = (self.u**2).sum(axis=1)
+        self.pseudoinversas = {}
+
+    def pseudoinversa(self, ids):
+        """(AᵀA)⁻¹Aᵀ (dimensión + 1, k) con solo las filas de los anchors ids (índices
+        en anclas), o None si son menos de los necesarios o están alineados (en 3D,
+        también si están a la misma altura)"""
+        ids = np.asarray(ids, dtype=np.int64)
+        clave = ids.tobytes()
+        if clave not in self.pseudoinversas:
+            if len(self.pseudoinversas) >= PSEUDOINVERSAS_MAX:
+                self.pseudoinversas.clear()
+            P = None
+            if len(ids) >= self.minimo:
+                A = self.A[ids]
+                M = A.T @ A
+                try:
+                    M_inv = np.linalg.inv(M)
+                    if _condicion(M, M_inv) < CONDICION_MAX:
+                        P = M_inv @ A.T
+                except np.linalg.LinAlgError:
+                    pass
+            self.pseudoinversas[clave] = P
+        return self.pseudoinversas[clave]
+
+
+def elipse_error(covarianzas):
+    """elipse de error a 1σ de covarianzas (T, 2, 2) (o el bloque xy de las de 3D):
+    semieje mayor y menor (m) y ángulo del mayor desde el eje x (grados, -90..90);
+    NaN donde la covarianza no es finita"""
+    C = np.asarray(covarianzas, dtype=float)[..., :2, :2]
+    xx, xy, yy = C[..., 0, 0], C[..., 0, 1], C[..., 1, 1]
+    media = (xx + yy) / 2
+    radio = np.hypot((xx - yy) / 2, xy)
+    mayor = np.sqrt(np.maximum(media + radio, 0.0))
+    menor = np.sqrt(np.maximum(media - radio, 0.0))
+    angulo = np.degrees(np.arctan2(2 * xy, xx - yy) / 2)
+    return mayor, menor, angulo
+
+
+def _peso_robusto(z):
+    """ψ(z)/z de la pérdida, para los mínimos cuadrados reponderados"""
+    a = np.abs(z)
+    if PERDIDA == 'huber':
+        return np.where(a <= HUBER_K, 1.0, HUBER_K / np.maximum(a, HUBER_K))
+    if PERDIDA == 'tukey':
+        return np.where(a < TUKEY_C, (1 - (z / TUKEY_C)**2)**2, 0.0)
+    return np.ones_like(z)
+
+
+def _perdida(z):
+    a = np.abs(z)
+    if PERDIDA == 'huber':
+        return np.where(a <= HUBER_K, z**2 / 2, HUBER_K * (a - HUBER_K / 2))
+    if PERDIDA == 'tukey':
+        c2 = TUKEY_C**2 / 6
+        return np.where(a < TUKEY_C, c2 * (1 - (1 - (z / TUKEY_C)**2)**3), c2)
+    return z**2 / 2
+
+
+class _Tags:
+    """anchors (T, K, dimensión), distancias, varianzas y desviaciones de un grupo de tags, en
+    las unidades normalizadas de la geometría"""
+
+    def __init__(self, u, d, v, sigma, b):
+        self.u, self.d, self.v, self.sigma, self.b = u, d, v, sigma, b
+
+    def filas(self, filas):
+        return _Tags(self.u[filas], self.d[filas], self.v[filas], self.sigma[filas], self.b[filas])
+
+    def residuos(self, p):
+        delta = p[:, None, :] - self.u
+        r = np.sqrt((delta**2).sum(axis=2))
+        return delta, r, r - self.d
+
+    def evaluar(self, p, usar, robusta):
+        """JᵀWJ, JᵀWr y coste Σ (s²/v)·ρ(r/s) de ri = |p - ai| - di; sin pérdida
+        robusta los pesos son 1 / var (covarianza)"""
+        delta, r, res = self.residuos(p)
+        z = res / self.sigma
+        with np.errstate(invalid='ignore'):
+            if robusta:
+                coste = np.where(usar, self.sigma**2 / self.v * _perdida(z), 0.0).sum(axis=1)
+                w = np.where(usar, _peso_robusto(z) / self.v, 0.0)
+            else:
+                coste = np.where(usar, res**2 / (2 * self.v), 0.0).sum(axis=1)
+                w = np.where(usar, 1.0 / self.v, 0.0)
+        w = np.where(r > 0, w, 0.0)
+        J = delta / np.where(r > 0, r, 1.0)[:, :, None]
+        wJ = w[:, :, None] * J
+        H = np.einsum('tki,tkj->tij', wJ, J)
+        g = np.einsum('tki,tk->ti', wJ, res)
+        return H, g, coste
+
+    def atipicos(self, p, usar):
+        res = self.residuos(p)[2]
+        with np.errstate(invalid='ignore'):
+            return usar & (np.abs(res) / self.sigma > Z_RECHAZO)
+
+    def puntuacion(self, p, usar):
+        """MSAC: residuos tipificados al cuadrado, truncados en Z_RECHAZO"""
+        res = self.residuos(p)[2]
+        with np.errstate(invalid='ignore'):
+            return np.where(usar, np.minimum((res / self.sigma)**2, Z_RECHAZO**2), 0.0).sum(axis=1)
+
+
+def _inversa(H):
+    """inversas de una pila de matrices 2x2 (explícita) o 3x3 y si son utilizables"""
+    if H.shape[-1] == 2:
+        det = H[:, 0, 0] * H[:, 1, 1] - H[:, 0, 1] * H[:, 1, 0]
+        adj = np.empty_like(H)
+        adj[:, 0, 0], adj[:, 1, 1] = H[:, 1, 1], H[:, 0, 0]
+        adj[:, 0, 1], adj[:, 1, 0] = -H[:, 0, 1], -H[:, 1, 0]
+        with np.errstate(divide='ignore', invalid='ignore'):
+            H_inv = adj / det[:, None, None]
+    else:
+        finitas = np.isfinite(H).all(axis=(1, 2))
+        det = np.where(finitas, np.linalg.det(np.where(finitas[:, None, None], H, 0.0)), 0.0)
+        seguras = np.where((det != 0)[:, None, None], H, np.eye(H.shape[-1]))
+        H_inv = np.where((det != 0)[:, None, None], np.linalg.inv(seguras), np.nan)
+    return H_inv, (det != 0) & (_condicion(H, H_inv) < CONDICION_MAX)
+
+
+def _refinar(tags, p, usar, escala):
+    """Levenberg-Marquardt con la pérdida robusta, vectorizado y solo sobre los tags
+    que aún no han terminado. Devuelve las posiciones y si se han podido refinar"""
+    p = p.copy()
+    n = len(p)
+    H, g, coste = tags.evaluar(p, usar, True)
+    lam = np.full(n, 1e-3)
+    refinado = np.isfinite(p).all(axis=1)
+    activos = np.flatnonzero(refinado)
+    for iteracion in range(ITERACIONES_MAX):
+        if not len(activos):
+            break
+        amortiguada = H[activos].copy()
+        diagonal = np.arange(H.shape[-1])
+        amortiguada[:, diagonal, diagonal] *= 1 + lam[activos, None]
+        H_inv, invertible = _inversa(amortiguada)
+        if iteracion == 0:
+            refinado[activos[~invertible]] = False
+        paso = -np.einsum('tij,tj->ti', H_inv, g[activos])
+        paso[~invertible] = 0.0
+
+        sub = tags.filas(activos)
+        candidata = p[activos] + paso
+        H_c, g_c, coste_c = sub.evaluar(candidata, usar[activos], True)
+        acepta = invertible & np.isfinite(coste_c) & (coste_c <= coste[activos])
+
+        i = activos[acepta]
+        p[i], H[i], g[i], coste[i] = candidata[acepta], H_c[acepta], g_c[acepta], coste_c[acepta]
+        lam[i] = np.maximum(lam[i] * 0.1, 1e-7)
+        lam[activos[~acepta]] *= 10
+
+        corto = (paso**2).sum(axis=1) * escala**2 < TOLERANCIA_M**2
+        termina = (acepta & corto) | ~invertible | (lam[activos] > 1e7)
+        activos = activos[~termina]
+    return p, refinado & np.isfinite(p).all(axis=1)
+
+
+def _ransac(geometria, tags, mascara, ids, p):
+    """mejor solución lineal de los tríos de anchors (cuartetos en 3D) de la máscara
+    (columnas de la fila, ids sus anchors en la geometría) según MSAC, para tags con
+    los mismos anchors válidos; empieza por la posición actual"""
+    usar = np.broadcast_to(mascara, tags.d.shape)
+    mejor = tags.puntuacion(p, usar)
+    mejor[~np.isfinite(mejor)] = np.inf
+    p = p.copy()
+
+    indices = np.flatnonzero(mascara)
+    trios = list(itertools.combinations(indices, geometria.minimo))
+    if len(trios) > RANSAC_MAX_SUBCONJUNTOS:
+        # semilla fija: las mismas distancias dan siempre la misma posición
+        elegidos = np.random.default_rng(0).choice(len(trios), RANSAC_MAX_SUBCONJUNTOS, replace=False)
+        trios = [trios[k] for k in elegidos]
+
+    for trio in trios:
+        trio = list(trio)
+        P = geometria.pseudoinversa(ids[trio])
+        if P is None:
+            continue
+        q = tags.b[:, trio] @ P[:-1].T
+        puntuacion = tags.puntuacion(q, usar)
+        mejora = puntuacion < mejor
+        p[mejora], mejor[mejora] = q[mejora], puntuacion[mejora]
+    return p
+
+
+def _agrupar(validas, indices):
+    """(máscara, ids, filas) de cada subconjunto distinto de anchors válidos: las
+    columnas válidas de la fila y sus anchors en la geometría"""
+    claves = np.ascontiguousarray(np.where(validas, indices, -1).astype(np.int32))
+    claves = claves.view(f'V{4 * claves.shape[1]}').ravel()
+    _, primera, grupo = np.unique(claves, return_index=True, return_inverse=True)
+    orden = np.argsort(grupo.reshape(-1), kind='stable')
+    limites = np.cumsum(np.bincount(grupo.reshape(-1), minlength=len(primera)))
+    return [(validas[primera[k]], indices[primera[k]][validas[primera[k]]], filas)
+            for k, filas in enumerate(np.split(orden, limites)[:-1])]
+
+
+def resolver_multilateracion(anclas, distancias, varianzas, indices=None):
+    """posición de todos los tags a la vez con todos los anchors que tengan distancia.
+
+    anclas: GeometriaAnclas (o posiciones (N, 2) o (N, 3), sin caché); distancias y
+    varianzas: (T, N) en m y m², NaN en los pares sin medida. Con indices (T, K), cada
+    tag tiene sus propios K anchors (índices en anclas, -1 donde tiene menos) y
+    distancias y varianzas son (T, K) en ese orden, para despliegues en los que cada
+    tag solo ve los anchors cercanos (ver indice_anclas). Cada anchor i da la ecuación lineal
+    en (x, y, R = x²+y²)
+        2·xi·x + 2·yi·y - R = xi² + yi² - di²
+    (en 3D, con z y R = x²+y²+z²) que no necesita anchor de referencia, así que cada tag es un producto por la
+    pseudoinversa guardada de su subconjunto de anchors. Esa solución se refina con
+    Levenberg-Marquardt y la pérdida PERDIDA, ponderando por 1 / var(di); si quedan
+    anchors atípicos y hay RANSAC_MIN_ANCLAS o más, se prueba también desde el mejor
+    trío (cuarteto en 3D) de anchors (RANSAC) y se queda la solución de menor coste. Los anchors con
+    residuo tipificado mayor que Z_RECHAZO se rechazan y la covarianza es (JᵀWJ)⁻¹
+    con los demás. Devuelve una Solucion: posiciones (T, D), covarianzas (T, D, D),
+    anchors usados (T,), residuos (T, N) en m y anchors rechazados (T, N) (o (T, K));
+    NaN donde no hay solución."""
+    geometria = anclas if isinstance(anclas, GeometriaAnclas) else GeometriaAnclas(anclas)
+    distancias = np.atleast_2d(np.asarray(distancias, dtype=float))
+    varianzas = np.atleast_2d(np.asarray(varianzas, dtype=float))
+    n_tags = distancias.shape[0]
+    escala = geometria.escala
+    dimension = geometria.dimension
+
+    validas = np.isfinite(distancias) & (distancias >= 0)
+    if indices is None:
+        indices = np.broadcast_to(np.arange(len(geometria.anclas)), distancias.shape)
+        u = np.broadcast_to(geometria.u, distancias.shape + (dimension,))
+        norma2 = geometria.norma2
+    else:
+        indices = np.atleast_2d(np.asarray(indices, dtype=np.int64))
+        validas &= indices >= 0
+        cualquiera = np.where(indices >= 0, indices, 0)
+        u, norma2 = geometria.u[cualquiera], geometria.norma2[cualquiera]
+    n_anclas = validas.sum(axis=1)
+    d = np.where(validas, distancias, 0.0) / escala
+    v = np.maximum(np.where(np.isfinite(varianzas), varianzas, VARIANZA_DEFECTO_M2), VARIANZA_MIN_M2)
+    sigma = np.maximum(np.sqrt(v), SIGMA_MIN_ROBUSTA_M) / escala
+    tags = _Tags(u, d, v / escala**2, sigma, norma2 - d**2)
+
+    # solución lineal: una multiplicación por subconjunto distinto de anchors
+    grupos = _agrupar(validas, indices)
+    p = np.full((n_tags, dimension), np.nan)
+    for mascara, ids, filas in grupos:
+        P = geometria.pseudoinversa(ids)
+        if P is not None:
+            p[filas] = tags.b[np.ix_(filas, np.flatnonzero(mascara))] @ P[:-1].T
 
-    A1 = [-2 * (x1 - x2), -2 * (y1 - y2)]
-    b1 = d1**2 - d2**2 - x1**2 + x2**2 - y1**2 + y2**2
+    p, refinado = _refinar(tags, p, validas, escala)
 
-    A2 = [-2 * (x1 - x3), -2 * (y1 - y3)]
-    b2 = d1**2 - d3**2 - x1**2 + x3**2 - y1**2 + y3**2
+    # RANSAC solo donde el refinado no ha podido o deja atípicos: los tríos se
+    # prueban por subconjunto de anchors y el refinado se hace de una vez
+    necesita = (n_anclas >= RANSAC_MIN_ANCLAS + dimension - 2) & (~refinado | tags.atipicos(p, validas).any(axis=1))
+    if necesita.any():
+        q = p.copy()
+        for mascara, ids, filas in grupos:
+            filas = filas[necesita[filas]]
+            if len(filas):
+                q[filas] = _ransac(geometria, tags.filas(filas), mascara, indices[filas[0]], p[filas])
+        filas = np.flatnonzero(necesita)
+        sub = tags.filas(filas)
+        usar = validas[filas]
+        q, ok = _refinar(sub, q[filas], usar, escala)
+        coste_q = sub.evaluar(q, usar, True)[2]
+        coste_p = sub.evaluar(np.nan_to_num(p[filas]), usar, True)[2]
+        mejor = ok & (~refinado[filas] | (coste_q < coste_p))
+        p[filas[mejor]] = q[mejor]
+        refinado[filas[mejor]] = True
 
-    A = np.array([A1, A2])
-    b = np.array([b1, b2])
+    # rechazo, mientras queden anchors suficientes para fijar la posición
+    rechazados = tags.atipicos(p, validas) & refinado[:, None]
+    rechazados[(validas & ~rechazados).sum(axis=1) < geometria.minimo] = False
+    usadas = validas & ~rechazados
 
-    try:
-        sol = np.linalg.solve(A, b)
-        return sol[0], sol[1]
-    except np.linalg.LinAlgError:
-        return np.nan, np.nan
+    H, _, _ = tags.evaluar(np.nan_to_num(p), usadas, False)
+    H_inv, invertible = _inversa(H)
+    bien = refinado & invertible
 
+    posiciones = np.full((n_tags, dimension), np.nan)
+    covarianzas = np.full((n_tags, dimension, dimension), np.nan)
+    residuos = np.full(distancias.shape, np.nan)
+    posiciones[bien] = p[bien] * escala + geometria.centro
+    covarianzas[bien] = H_inv[bien] * escala**2
+    res = tags.residuos(np.nan_to_num(p))[2] * escala
+    residuos[bien] = np.where(validas[bien], res[bien], np.nan)
+    rechazados[~bien] = False
+    n = np.where(bien, usadas.sum(axis=1), n_anclas)
+    return Solucion(posiciones, covarianzas, n, residuos, rechazados)
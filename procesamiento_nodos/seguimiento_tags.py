@@ -0,0 +1,181 @@
+import numpy as np
+
+# seguimiento de los tags con un filtro de Kalman extendido de velocidad constante,
+# estado [x, y, vx, vy], que se actualiza con cada distancia (tag, anchor) que llega
+# en data_tag en lugar de con las posiciones de la multilateración
+
+# densidad espectral (m²/s³) de la aceleración de cada clase de movimiento
+# (devices.motion_class); la que no está en la tabla usa CLASE_DEFECTO
+RUIDO_PROCESO = {
+    'asset': 0.01,
+    'person': 0.5,
+    'vehicle': 4.0,
+}
+CLASE_DEFECTO = 'person'
+# varianza (m²) de una distancia suelta si su par no tiene aún varianza propia
+VARIANZA_DISTANCIA_M2 = 0.09
+VARIANZA_MIN_M2 = 1e-3
+# varianza inicial (m²/s²) de la velocidad, la pista empieza parada
+VARIANZA_VELOCIDAD_INICIAL = 1.0
+# innovación tipificada a partir de la cual se descarta una distancia (NLOS), y
+# descartes seguidos tras los que la pista se reinicia con la siguiente posición
+PUERTA_Z = 3.0
+RECHAZOS_REINICIO = 20
+# una pista que lleva este tiempo (s) sin distancias también se reinicia
+PISTA_CADUCA_S = 30
+CAPACIDAD_INICIAL = 256
+
+
+def ruido_proceso(dt, q):
+    """Q de velocidad constante para saltos dt (k,) y densidades q (k,)"""
+    dt2 = dt * dt
+    Q = np.zeros((len(dt), 4, 4))
+    for i in (0, 1):
+        Q[:, i, i] = q * dt2 * dt / 3
+        Q[:, i, i + 2] = Q[:, i + 2, i] = q * dt2 / 2
+        Q[:, i + 2, i + 2] = q * dt
+    return Q
+
+
+def predecir(x, P, q, dt):
+    """estado y covarianza (k,4) y (k,4,4) llevados dt (k,) segundos hacia delante"""
+    dt = np.maximum(dt, 0.0)
+    x = x.copy()
+    x[:, 0:2] += x[:, 2:4] * dt[:, None]
+    F = np.broadcast_to(np.eye(4), P.shape).copy()
+    F[:, 0, 2] = F[:, 1, 3] = dt
+    P = F @ P @ F.transpose(0, 2, 1) + ruido_proceso(dt, q)
+    return x, P
+
+
+class SeguimientoTags:
+    """pistas de todos los tags en arrays contiguos (estructura de arrays): el hueco de
+    cada tag se asigna la primera vez que aparece y los arrays crecen al doble cuando
+    se llenan. Cada distancia cuesta una predicción y una actualización escalar; las
+    de tags distintos se procesan juntas"""
+
+    def __init__(self, capacidad=CAPACIDAD_INICIAL):
+        self.huecos = {}
+        self.ids = np.zeros(capacidad, dtype=np.int64)
+        self.x = np.zeros((capacidad, 4))
+        self.P = np.zeros((capacidad, 4, 4))
+        self.t = np.zeros(capacidad)
+        self.q = np.zeros(capacidad)
+        self.iniciada = np.zeros(capacidad, dtype=bool)
+        self.rechazos = np.zeros(capacidad, dtype=np.int32)
+
+    def __len__(self):
+        return len(self.huecos)
+
+    def _crecer(self):
+        capacidad = 2 * len(self.ids)
+        for nombre in ('ids', 'x', 'P', 't', 'q', 'iniciada', 'rechazos'):
+            viejo = getattr(self, nombre)
+            nuevo = np.zeros((capacidad,) + viejo.shape[1:], dtype=viejo.dtype)
+            nuevo[:len(viejo)] = viejo
+            setattr(self, nombre, nuevo)
+
+    def hueco(self, tag_id, clase=None):
+        """índice de la pista del tag (se crea sin iniciar si no existe); la clase de
+        movimiento se vuelve a aplicar siempre que se indica"""
+        i = self.huecos.get(tag_id)
+        if i is None:
+            i = len(self.huecos)
+            if i == len(self.ids):
+                self._crecer()
+            self.huecos[tag_id] = i
+            self.ids[i] = tag_id
+            self.q[i] = RUIDO_PROCESO[CLASE_DEFECTO]
+        if clase is not None:
+            self.q[i] = RUIDO_PROCESO.get(clase, RUIDO_PROCESO[CLASE_DEFECTO])
+        return i
+
+    def iniciar(self, tag_ids, t, posiciones, covarianzas):
+        """se inician con una posición de la multilateración (t en s) las pistas que no
+        lo están"""
+        for tag_id, ti, p, cov in zip(tag_ids, t, posiciones, covarianzas):
+            i = self.hueco(tag_id)
+            if self.iniciada[i] or not np.all(np.isfinite(p)):
+                continue
+            self.x[i] = (p[0], p[1], 0.0, 0.0)
+            self.P[i] = np.diag([0.0, 0.0, VARIANZA_VELOCIDAD_INICIAL, VARIANZA_VELOCIDAD_INICIAL])
+            self.P[i, :2, :2] = cov if np.all(np.isfinite(cov)) else np.eye(2) * VARIANZA_DISTANCIA_M2
+            self.t[i] = ti
+            self.iniciada[i] = True
+            self.rechazos[i] = 0
+
+    def actualizar(self, tag_ids, t, anclas, distancias, varianzas):
+        """EKF con distancias sueltas: tag_ids, t (s), distancias y varianzas (m) de forma
+        (M,) y anclas (M,2). Las de tags sin pista iniciada se ignoran (ya entran en la
+        posición con la que se inician). Devuelve el número de distancias aceptadas"""
+        huecos = np.array([self.huecos.get(tag_id, -1) for tag_id in tag_ids], dtype=np.int64)
+        t = np.asarray(t, dtype=float)
+        validas = huecos >= 0
+        caducas = huecos[validas][t[validas] - self.t[huecos[validas]] > PISTA_CADUCA_S]
+        self.iniciada[caducas] = False
+        validas[validas] &= self.iniciada[huecos[validas]]
+        validas &= np.isfinite(distancias)
+        if not validas.any():
+            return 0
+        huecos, t = huecos[validas], t[validas]
+        anclas = np.asarray(anclas, dtype=float)[validas]
+        distancias = np.asarray(distancias, dtype=float)[validas]
+        varianzas = np.asarray(varianzas, dtype=float)[validas]
+        varianzas = np.maximum(np.where(np.isfinite(varianzas), varianzas, VARIANZA_DISTANCIA_M2),
+                               VARIANZA_MIN_M2)
+
+        # las distancias de un mismo tag se aplican en orden de llegada: se reparten en
+        # rondas en las que cada tag aparece como mucho una vez
+        orden = np.lexsort((t, huecos))
+        inicio = np.r_[0, np.flatnonzero(np.diff(huecos[orden])) + 1]
+        ronda = np.arange(len(orden)) - np.repeat(inicio, np.diff(np.r_[inicio, len(orden)]))
+        aceptadas = 0
+        for r in range(ronda.max() + 1):
+            k = orden[ronda == r]
+            aceptadas += self._actualizar_ronda(huecos[k], t[k], anclas[k], distancias[k], varianzas[k])
+        return aceptadas
+
+    def _actualizar_ronda(self, h, t, anclas, d, v):
+        # una medida anterior a la pista (solape de lectura) se aplica sin predecir
+        x, P = predecir(self.x[h], self.P[h], self.q[h], t - self.t[h])
+        self.t[h] = np.maximum(self.t[h], t)
+
+        dx = x[:, 0] - anclas[:, 0]
+        dy = x[:, 1] - anclas[:, 1]
+        r = np.hypot(dx, dy)
+        r_seguro = np.where(r > 0, r, 1.0)
+        H = np.zeros((len(h), 4))
+        H[:, 0], H[:, 1] = dx / r_seguro, dy / r_seguro
+        PH = np.einsum('kij,kj->ki', P, H)
+        S = np.einsum('ki,ki->k', H, PH) + v
+        innovacion = d - r
+        aceptada = (r > 0) & (innovacion**2 < PUERTA_Z**2 * S)
+
+        K = PH / S[:, None]
+        x[aceptada] += K[aceptada] * innovacion[aceptada, None]
+        P[aceptada] -= np.einsum('ki,kj->kij', K[aceptada], PH[aceptada])
+        P = (P + P.transpose(0, 2, 1)) / 2
+        self.x[h], self.P[h] = x, P
+
+        self.rechazos[h] = np.where(aceptada, 0, self.rechazos[h] + 1)
+        self.iniciada[h] &= self.rechazos[h] < RECHAZOS_REINICIO
+        return int(aceptada.sum())
+
+    def estado(self, tag_ids, t):
+        """posición y velocidad (k,4) y covarianza (k,4,4) predichas en el instante t (s)
+        sin modificar las pistas; NaN en los tags sin pista iniciada"""
+        huecos = np.array([self.huecos.get(tag_id, -1) for tag_id in tag_ids], dtype=np.int64)
+        x = np.full((len(huecos), 4), np.nan)
+        P = np.full((len(huecos), 4, 4), np.nan)
+        ok = huecos >= 0
+        ok[ok] &= self.iniciada[huecos[ok]]
+        h = huecos[ok]
+        x[ok], P[ok] = predecir(self.x[h], self.P[h], self.q[h], t - self.t[h])
+        return x, P
+
+    def pistas(self, tag_ids):
+        """estado sin predecir de las pistas iniciadas de tag_ids: (id, t, x, P, q)"""
+        for tag_id in tag_ids:
+            i = self.huecos.get(tag_id)
+            if i is not None and self.iniciada[i]:
+                yield tag_id, self.t[i], self.x[i], self.P[i], self.q[i]